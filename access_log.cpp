@@ -0,0 +1,271 @@
+#include "access_log.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sys/time.h>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <functional>
+#include <glog/logging.h>
+
+struct AccessSlot {
+	//sequence of the ring position the slot holds, see Ring
+	std::atomic<size_t> seq;
+	bool error;
+	//time of commit in microseconds
+	long long us;
+	size_t len;
+	char data[AccessRecordSize];
+};
+
+/**
+ * bounded multi producer single consumer ring. slot i is free for the
+ * producer of position pos when seq == pos, and filled for the consumer
+ * when seq == pos + 1. producers claim positions with a CAS on tail.
+ */
+class AccessRing {
+	public:
+		explicit AccessRing(size_t size):tail(0), head(0) {
+			capacity = 1;
+			while (capacity < size) {
+				capacity <<= 1;
+			}
+			mask = capacity - 1;
+			slots = new AccessSlot[capacity];
+			for (size_t i = 0; i < capacity; i ++) {
+				slots[i].seq.store(i, std::memory_order_relaxed);
+			}
+		}
+
+		~AccessRing() {
+			delete [] slots;
+		}
+
+		//return false if the ring is full
+		bool push(const char *data, size_t len, bool error, long long us) {
+			size_t pos = tail.load(std::memory_order_relaxed);
+			AccessSlot *slot = NULL;
+			while (true) {
+				slot = &slots[pos & mask];
+				size_t seq = slot->seq.load(std::memory_order_acquire);
+				long diff = (long)seq - (long)pos;
+				if (diff == 0) {
+					if (tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+						break;
+					}
+				} else if (diff < 0) {
+					return false;
+				} else {
+					pos = tail.load(std::memory_order_relaxed);
+				}
+			}
+			memcpy(slot->data, data, len);
+			slot->len = len;
+			slot->error = error;
+			slot->us = us;
+			slot->seq.store(pos + 1, std::memory_order_release);
+			return true;
+		}
+
+		//the next filled slot of the consumer, NULL if empty
+		AccessSlot *front() {
+			AccessSlot *slot = &slots[head & mask];
+			if (slot->seq.load(std::memory_order_acquire) != head + 1) {
+				return NULL;
+			}
+			return slot;
+		}
+
+		//free the slot returned by front
+		void pop() {
+			slots[head & mask].seq.store(head + capacity, std::memory_order_release);
+			head ++;
+		}
+
+	private:
+		size_t capacity;
+		size_t mask;
+		AccessSlot *slots;
+		std::atomic<size_t> tail;
+		//only touched by the consumer
+		size_t head;
+};
+
+static AccessRing *ring = NULL;
+static FILE *logFile = NULL;
+static std::thread writer;
+static std::atomic<bool> stopping(false);
+static std::atomic<size_t> dropped(0);
+
+static double defaultRate = 1.0;
+static std::vector<std::pair<std::string, double> > cmdRates;
+
+static long long nowUs() {
+	struct timeval tv;
+	gettimeofday(&tv, NULL);
+	return (long long)tv.tv_sec * 1000000 + tv.tv_usec;
+}
+
+//write one record as "yyyy-mm-dd hh:mm:ss.uuuuuu I|W record\n"
+static void writeSlot(const AccessSlot *slot) {
+	time_t sec = slot->us / 1000000;
+	struct tm tm;
+	localtime_r(&sec, &tm);
+	char prefix[64];
+	size_t n = strftime(prefix, sizeof(prefix), "%Y-%m-%d %H:%M:%S", &tm);
+	n += snprintf(prefix + n, sizeof(prefix) - n, ".%06lld %c ",
+			slot->us % 1000000, slot->error ? 'W' : 'I');
+	fwrite(prefix, 1, n, logFile);
+	fwrite(slot->data, 1, slot->len, logFile);
+	fputc('\n', logFile);
+}
+
+static void writeLoop() {
+	size_t reported = 0;
+	while (true) {
+		AccessSlot *slot = ring->front();
+		if (slot != NULL) {
+			writeSlot(slot);
+			ring->pop();
+			continue;
+		}
+		fflush(logFile);
+		size_t n = dropped.load(std::memory_order_relaxed);
+		if (n != reported) {
+			LOG(WARNING) << "access log ring full, dropped records:" << n;
+			reported = n;
+		}
+		if (stopping.load()) {
+			return;
+		}
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+}
+
+int AccessLog::init(const std::string &path, size_t ringSize, double rate, const std::string &rates) {
+	defaultRate = rate;
+	cmdRates.clear();
+	//parse cmd=rate,cmd=rate
+	size_t start = 0;
+	while (start < rates.length()) {
+		size_t end = rates.find(',', start);
+		if (end == std::string::npos) {
+			end = rates.length();
+		}
+		std::string item = rates.substr(start, end - start);
+		start = end + 1;
+		size_t eq = item.find('=');
+		if (eq == std::string::npos) {
+			LOG(WARNING) << "invalid access log sample:" << item;
+			return -1;
+		}
+		cmdRates.push_back(std::make_pair(item.substr(0, eq), atof(item.c_str() + eq + 1)));
+	}
+	if (path.length() < 1) {
+		return 0;
+	}
+	logFile = fopen(path.c_str(), "a");
+	if (NULL == logFile) {
+		LOG(WARNING) << "open access log failed:" << path;
+		return -1;
+	}
+	//the writer thread is the only user of the file
+	setvbuf(logFile, NULL, _IOFBF, 1 << 20);
+	ring = new AccessRing(ringSize > 0 ? ringSize : 1);
+	writer = std::thread(writeLoop);
+	LOG(INFO) << "access log:" << path << " ring:" << ringSize
+		<< " sample_rate:" << defaultRate << " sample:" << rates;
+	return 0;
+}
+
+void AccessLog::stop() {
+	if (NULL == ring) {
+		return;
+	}
+	stopping.store(true);
+	writer.join();
+	fclose(logFile);
+}
+
+bool AccessLog::sample(const char *cmd) {
+	double rate = defaultRate;
+	for (size_t i = 0; i < cmdRates.size(); i ++) {
+		if (cmdRates[i].first == cmd) {
+			rate = cmdRates[i].second;
+			break;
+		}
+	}
+	if (rate >= 1) {
+		return true;
+	} else if (rate <= 0) {
+		return false;
+	}
+	//xorshift, one state per thread
+	static thread_local unsigned long long state =
+		std::hash<std::thread::id>()(std::this_thread::get_id()) | 1;
+	state ^= state << 13;
+	state ^= state >> 7;
+	state ^= state << 17;
+	return (state >> 11) * (1.0 / 9007199254740992.0) < rate;
+}
+
+void AccessLog::append(const char *data, size_t len, bool error) {
+	if (NULL == ring) {
+		if (error) {
+			LOG(WARNING) << std::string(data, len);
+		} else {
+			LOG(INFO) << std::string(data, len);
+		}
+		return;
+	}
+	if (!ring->push(data, len, error, nowUs())) {
+		dropped.fetch_add(1, std::memory_order_relaxed);
+	}
+}
+
+AccessRecord::AccessRecord(const char *cmd):len(0) {
+	keep = AccessLog::sample(cmd);
+}
+
+void AccessRecord::commit(bool error) {
+	if (keep || error) {
+		AccessLog::append(buf, len, error);
+	}
+}
+
+void AccessRecord::append(const char *s, size_t n) {
+	n = std::min(n, AccessRecordSize - len);
+	memcpy(buf + len, s, n);
+	len += n;
+}
+
+AccessRecord &AccessRecord::operator<<(const char *s) {
+	append(s, strlen(s));
+	return *this;
+}
+
+AccessRecord &AccessRecord::operator<<(const std::string &s) {
+	append(s.data(), s.length());
+	return *this;
+}
+
+void AccessRecord::appendSigned(long long v) {
+	char tmp[24];
+	append(tmp, snprintf(tmp, sizeof(tmp), "%lld", v));
+}
+
+void AccessRecord::appendUnsigned(unsigned long long v) {
+	char tmp[24];
+	append(tmp, snprintf(tmp, sizeof(tmp), "%llu", v));
+}
+
+void AccessRecord::appendDouble(double v) {
+	//same as the default ostream precision
+	char tmp[32];
+	append(tmp, snprintf(tmp, sizeof(tmp), "%g", v));
+}
@@ -0,0 +1,156 @@
+#include "admission.h"
+#include <stdio.h>
+#include <algorithm>
+#include <glog/logging.h>
+
+static const char *ClassNames[WorkClasses] = {"search", "bulk_search", "insert", "persist", "admin"};
+
+//waiting work rechecks its deadline at least this often
+static const std::chrono::milliseconds MaxWaitSlice(5);
+
+Admission::Admission():yield(0),waiters(0) {}
+
+const char *Admission::className(WorkClass cls) {
+	return ClassNames[cls];
+}
+
+const char *Admission::errorMsg(int rc) {
+	return rc == DEADLINE_EXCEEDED ? "deadline exceeded" : "server busy";
+}
+
+int Admission::init(const std::string &limits, int yieldMs) {
+	//parse class=concurrency/rate/queue,...
+	size_t start = 0;
+	while (start < limits.length()) {
+		size_t end = limits.find(',', start);
+		if (end == std::string::npos) {
+			end = limits.length();
+		}
+		std::string item = limits.substr(start, end - start);
+		start = end + 1;
+		size_t eq = item.find('=');
+		if (eq == std::string::npos) {
+			LOG(WARNING) << "invalid admission limits:" << item;
+			return -1;
+		}
+		std::string name = item.substr(0, eq);
+		int cls = 0;
+		while (cls < WorkClasses && name != ClassNames[cls]) {
+			cls ++;
+		}
+		WorkLimits l;
+		if (cls >= WorkClasses ||
+				sscanf(item.c_str() + eq + 1, "%d/%lf/%d", &l.concurrency, &l.rate, &l.queue) != 3) {
+			LOG(WARNING) << "invalid admission limits:" << item;
+			return -1;
+		}
+		ClassState &s = states[cls];
+		s.limits = l;
+		s.tokens = std::max(1.0, l.rate);
+		s.refilled = Clock::now();
+	}
+	yield = std::chrono::milliseconds(std::max(0, yieldMs));
+	LOG(INFO) << "admission limits:" << limits << " yield_ms:" << yieldMs;
+	return 0;
+}
+
+bool Admission::ready(WorkClass cls, Clock::time_point since, Clock::time_point now, Clock::duration *wait) {
+	ClassState &s = states[cls];
+	*wait = MaxWaitSlice;
+	if (s.limits.concurrency > 0 && s.running >= s.limits.concurrency) {
+		return false;
+	}
+	if ((cls == WorkInsert || cls == WorkPersist) && yield.count() > 0 && now - since < yield) {
+		ClassState &search = states[WorkSearch];
+		if (search.running + search.waiting > 0) {
+			*wait = since + yield - now;
+			return false;
+		}
+	}
+	if (s.limits.rate > 0) {
+		//a burst of at most one second of work
+		double elapsed = std::chrono::duration<double>(now - s.refilled).count();
+		s.tokens = std::min(std::max(1.0, s.limits.rate), s.tokens + elapsed * s.limits.rate);
+		s.refilled = now;
+		if (s.tokens < 1) {
+			*wait = std::chrono::duration_cast<Clock::duration>(
+					std::chrono::duration<double>((1 - s.tokens) / s.limits.rate));
+			return false;
+		}
+	}
+	return true;
+}
+
+int Admission::enter(WorkClass cls, const Deadline *deadline) {
+	std::unique_lock<std::mutex> ulk(mutex);
+	ClassState &s = states[cls];
+	Clock::time_point since = Clock::now();
+	Clock::duration wait;
+	if (!ready(cls, since, since, &wait)) {
+		if (s.limits.queue > 0 && s.waiting >= s.limits.queue) {
+			s.rejected ++;
+			return RESOURCE_EXHAUSTED;
+		}
+		s.waiting ++;
+		waiters ++;
+		while (true) {
+			cond.wait_for(ulk, std::min(wait, Clock::duration(MaxWaitSlice)));
+			if (deadline != NULL && deadline->expired()) {
+				s.waiting --;
+				waiters --;
+				s.expired ++;
+				//inserts may wait for this search
+				cond.notify_all();
+				return DEADLINE_EXCEEDED;
+			}
+			if (ready(cls, since, Clock::now(), &wait)) {
+				break;
+			}
+		}
+		s.waiting --;
+		waiters --;
+	}
+	if (s.limits.rate > 0) {
+		s.tokens -= 1;
+	}
+	s.running ++;
+	s.admitted ++;
+	return 0;
+}
+
+void Admission::leave(WorkClass cls) {
+	std::lock_guard<std::mutex> guard(mutex);
+	states[cls].running --;
+	if (waiters > 0) {
+		cond.notify_all();
+	}
+}
+
+void Admission::stats(std::vector<ClassStats> *out) {
+	std::lock_guard<std::mutex> guard(mutex);
+	out->resize(WorkClasses);
+	for (int i = 0; i < WorkClasses; i ++) {
+		ClassStats &cs = (*out)[i];
+		const ClassState &s = states[i];
+		cs.name = ClassNames[i];
+		cs.limits = s.limits;
+		cs.running = s.running;
+		cs.waiting = s.waiting;
+		cs.admitted = s.admitted;
+		cs.rejected = s.rejected;
+		cs.expired = s.expired;
+	}
+}
+
+AdmissionTicket::AdmissionTicket(Admission *admission, WorkClass cls, const Deadline *deadline):
+	admission(admission),cls(cls),code(0) {
+	if (admission != NULL) {
+		code = admission->enter(cls, deadline);
+	}
+}
+
+AdmissionTicket::~AdmissionTicket() {
+	if (admission != NULL && 0 == code) {
+		admission->leave(cls);
+	}
+}
@@ -0,0 +1,151 @@
+#include "async_server.h"
+#include <glog/logging.h>
+
+//one rpc waiting in a completion queue, the tag of its events
+class AsyncCall {
+	public:
+		virtual ~AsyncCall() {}
+
+		//ok is false if the queue is shut down
+		virtual void proceed(bool ok) = 0;
+};
+
+//request and response live on an arena started in the call object,
+//a call allocates nothing else unless its messages outgrow the block
+template <class Req, class Resp>
+class UnaryCall : public AsyncCall {
+	public:
+		typedef std::function<void(ServerContext*, Req*, grpc::ServerAsyncResponseWriter<Resp>*,
+				grpc::ServerCompletionQueue*, void*)> RequestFunc;
+		typedef std::function<Status(ServerContext*, const Req*, Resp*)> HandleFunc;
+
+		UnaryCall(const char *name, RequestFunc request, HandleFunc handle,
+				WorkerPool *pool, grpc::ServerCompletionQueue *cq):
+			name(name), request(request), handle(handle), pool(pool), cq(cq),
+			arena(arenaOptions(block)), responder(&ctx), finishing(false) {
+			req = google::protobuf::Arena::CreateMessage<Req>(&arena);
+			resp = google::protobuf::Arena::CreateMessage<Resp>(&arena);
+			request(&ctx, req, &responder, cq, this);
+		}
+
+		void proceed(bool ok) override {
+			if (finishing || !ok) {
+				delete this;
+				return;
+			}
+			//wait for the next call before handling this one
+			new UnaryCall<Req, Resp>(name, request, handle, pool, cq);
+			finishing = true;
+			bool accepted = pool->trySubmit([this]() {
+				Status status = handle(&ctx, req, resp);
+				responder.Finish(*resp, status, this);
+			});
+			if (!accepted) {
+				LOG(WARNING) << "cmd:" << name << " peer:" << ctx.peer() << " error_msg:server busy";
+				responder.FinishWithError(Status(grpc::StatusCode::RESOURCE_EXHAUSTED, "server busy"), this);
+			}
+		}
+
+	private:
+		const char *name;
+		RequestFunc request;
+		HandleFunc handle;
+		WorkerPool *pool;
+		grpc::ServerCompletionQueue *cq;
+
+		//block is declared before the arena using it
+		alignas(8) char block[CallArenaBlock];
+		google::protobuf::Arena arena;
+		Req *req;
+		Resp *resp;
+		ServerContext ctx;
+		grpc::ServerAsyncResponseWriter<Resp> responder;
+		//Finish is called, the next event ends the call
+		bool finishing;
+};
+
+AsyncServer::AsyncServer(FaissServiceImpl *impl):impl(impl), stopped(false) {
+	service.bind(impl);
+	//pinned pools get disjoint cpus
+	int cpu = globalConfig.PinWorkers ? 0 : -1;
+	searchPool.reset(new WorkerPool("search", globalConfig.SearchWorkers, globalConfig.SearchQueue, cpu));
+	if (cpu >= 0) {
+		cpu += searchPool->threads();
+	}
+	writePool.reset(new WorkerPool("write", globalConfig.WriteWorkers, globalConfig.WriteQueue, cpu));
+	if (cpu >= 0) {
+		cpu += writePool->threads();
+	}
+	adminPool.reset(new WorkerPool("admin", globalConfig.AdminWorkers, globalConfig.AdminQueue, cpu));
+}
+
+AsyncServer::~AsyncServer() {
+	stop();
+}
+
+void AsyncServer::registerTo(ServerBuilder *builder) {
+	builder->RegisterService(&service);
+	for (int i = 0; i < std::max(1, globalConfig.CqThreads); i ++) {
+		cqs.push_back(builder->AddCompletionQueue());
+	}
+}
+
+void AsyncServer::start() {
+	for (size_t i = 0; i < cqs.size(); i ++) {
+		requestCalls(cqs[i].get());
+		pollers.push_back(std::thread(&AsyncServer::poll, this, cqs[i].get()));
+	}
+	LOG(INFO) << "async server cq_threads:" << cqs.size();
+}
+
+void AsyncServer::stop() {
+	if (stopped) {
+		return;
+	}
+	stopped = true;
+	//queued calls still finish on the queues
+	searchPool->stop();
+	writePool->stop();
+	adminPool->stop();
+	for (size_t i = 0; i < cqs.size(); i ++) {
+		cqs[i]->Shutdown();
+	}
+	for (auto &th : pollers) {
+		th.join();
+	}
+}
+
+void AsyncServer::poll(grpc::ServerCompletionQueue *cq) {
+	void *tag = NULL;
+	bool ok = false;
+	while (cq->Next(&tag, &ok)) {
+		static_cast<AsyncCall*>(tag)->proceed(ok);
+	}
+}
+
+#define ASYNC_UNARY(Name, Req, Resp, pool) \
+	new UnaryCall< ::faiss_server::Req, ::faiss_server::Resp>(#Name, \
+		[this](ServerContext *ctx, ::faiss_server::Req *req, \
+				grpc::ServerAsyncResponseWriter< ::faiss_server::Resp> *responder, \
+				grpc::ServerCompletionQueue *cq, void *tag) { \
+			service.Request##Name(ctx, req, responder, cq, cq, tag); \
+		}, \
+		[this](ServerContext *ctx, const ::faiss_server::Req *req, ::faiss_server::Resp *resp) { \
+			return impl->Name(ctx, req, resp); \
+		}, pool, cq)
+
+void AsyncServer::requestCalls(grpc::ServerCompletionQueue *cq) {
+	ASYNC_UNARY(HSearch, HSearchRequest, HSearchResponse, searchPool.get());
+	ASYNC_UNARY(HSearchBatch, HSearchBatchRequest, HSearchBatchResponse, searchPool.get());
+	ASYNC_UNARY(HSearchMulti, HSearchMultiRequest, HSearchMultiResponse, searchPool.get());
+	ASYNC_UNARY(HGet, HGetDelRequest, HGetResponse, searchPool.get());
+	ASYNC_UNARY(HSet, HSetRequest, HSetResponse, writePool.get());
+	ASYNC_UNARY(HSetBatch, HSetBatchRequest, HSetBatchResponse, writePool.get());
+	ASYNC_UNARY(HDel, HGetDelRequest, EmptyResponse, writePool.get());
+	ASYNC_UNARY(Ping, PingRequest, PingResponse, adminPool.get());
+	ASYNC_UNARY(DbNew, DbNewRequest, EmptyResponse, adminPool.get());
+	ASYNC_UNARY(DbDel, DbDelRequest, EmptyResponse, adminPool.get());
+	ASYNC_UNARY(DbList, DbListRequest, DbListResponse, adminPool.get());
+}
+
+#undef ASYNC_UNARY
@@ -0,0 +1,199 @@
+//allocations per HSearch request of a L2 db without refine: a frozen copy
+//of the request path before the features were read in place, against the
+//search_result.h helpers, search buffers and call arena the server uses now.
+//usage: make bench, or ./alloc_bench [requests]
+#include <stdlib.h>
+#include <stdio.h>
+#include <atomic>
+#include <string>
+#include <vector>
+#include "faiss_def.pb.h"
+#include "utils.h"
+#include "search_result.h"
+#include "async_server.h"
+#include "faiss/IndexFlat.h"
+
+extern "C" void *__libc_malloc(size_t size);
+extern "C" void *__libc_calloc(size_t n, size_t size);
+extern "C" void *__libc_realloc(void *ptr, size_t size);
+extern "C" void __libc_free(void *ptr);
+
+static std::atomic<bool> counting(false);
+static std::atomic<long> allocs(0);
+
+//malloc hook, operator new and the protobuf arena blocks go through it too
+extern "C" void *malloc(size_t size) {
+	if (counting.load(std::memory_order_relaxed)) {
+		allocs.fetch_add(1, std::memory_order_relaxed);
+	}
+	return __libc_malloc(size);
+}
+
+extern "C" void *calloc(size_t n, size_t size) {
+	if (counting.load(std::memory_order_relaxed)) {
+		allocs.fetch_add(1, std::memory_order_relaxed);
+	}
+	return __libc_calloc(n, size);
+}
+
+extern "C" void *realloc(void *ptr, size_t size) {
+	if (counting.load(std::memory_order_relaxed)) {
+		allocs.fetch_add(1, std::memory_order_relaxed);
+	}
+	return __libc_realloc(ptr, size);
+}
+
+extern "C" void free(void *ptr) {
+	__libc_free(ptr);
+}
+
+static const int Dim = 128;
+static const int NVectors = 10000;
+static const int TopK = 10;
+//L2 threshold of the requests, keeps every candidate
+static const float Thresh = 1e9f;
+
+//the index search allocates the same in every path, it is not counted
+static void searchIndex(const faiss::Index *index, const float *x, size_t k,
+		float *dis, faiss::Index::idx_t *nns) {
+	counting.store(false);
+	index->search(1, x, k, dis, nns);
+	counting.store(true);
+}
+
+//frozen copy of HSearch before the in place features, the search buffers and
+//the call arena: heap messages, a copy of the feature, new nns/dis/nodes.
+//not server code, do not update it with the server
+static void searchBaseline(const faiss::Index *index, const std::string &wire, std::string *out) {
+	faiss_server::HSearchRequest *request = new faiss_server::HSearchRequest();
+	faiss_server::HSearchResponse *response = new faiss_server::HSearchResponse();
+	request->ParseFromString(wire);
+	response->set_request_id(request->request_id());
+	size_t topk = request->top_k();
+	float thresh = request->threshold();
+	std::vector<Node> nodes;
+	std::string feaStr = request->feature();
+	std::vector<faiss::Index::idx_t> nns(topk);
+	std::vector<float>               dis(topk);
+	searchIndex(index, (float*)feaStr.data(), topk, dis.data(), nns.data());
+	for (size_t j = 0; j < topk; j++) {
+		if (nns[j] < 0 || dis[j] > thresh) {
+			break;
+		}
+		Node node;
+		node.score = dis[j];
+		node.id = nns[j];
+		nodes.push_back(node);
+	}
+	for (auto it = nodes.begin(); it != nodes.end(); ++it) {
+		auto rs = response->add_results();
+		rs->set_score(it->score);
+		rs->set_id(it->id);
+	}
+	response->set_error_code(OK);
+	response->SerializeToString(out);
+	delete request;
+	delete response;
+}
+
+//the request path of SearchOne and searchDb now, with the search buffers of
+//the thread. FaissDB::prepareQueries of a L2 db is floatView
+static void searchServer(const faiss::Index *index, const std::string &wire,
+		faiss_server::HSearchRequest *request, faiss_server::HSearchResponse *response,
+		std::string *out) {
+	request->ParseFromString(wire);
+	response->set_request_id(request->request_id());
+	size_t topk = request->top_k();
+	std::vector<Node> &nodes = searchScratch.nodes;
+	nodes.clear();
+	std::vector<faiss::Index::idx_t> &nns = searchScratch.nns;
+	std::vector<float>               &dis = searchScratch.dis;
+	nns.resize(topk);
+	dis.resize(topk);
+	const float *query = floatView(request->feature(), &searchScratch.queries);
+	searchIndex(index, query, topk, dis.data(), nns.data());
+	appendCandidates(nns.data(), dis.data(), topk, topk, false, true, request->threshold(), &nodes);
+	fillResults(nodes, response->mutable_results());
+	response->set_error_code(OK);
+	response->SerializeToString(out);
+}
+
+//sync server: grpc owns heap messages
+static void searchSync(const faiss::Index *index, const std::string &wire, std::string *out) {
+	faiss_server::HSearchRequest *request = new faiss_server::HSearchRequest();
+	faiss_server::HSearchResponse *response = new faiss_server::HSearchResponse();
+	searchServer(index, wire, request, response, out);
+	delete request;
+	delete response;
+}
+
+//async server: messages on the arena of the call, as UnaryCall
+static void searchAsync(const faiss::Index *index, const std::string &wire, std::string *out) {
+	alignas(8) char block[CallArenaBlock];
+	google::protobuf::Arena arena(arenaOptions(block));
+	faiss_server::HSearchRequest *request =
+		google::protobuf::Arena::CreateMessage<faiss_server::HSearchRequest>(&arena);
+	faiss_server::HSearchResponse *response =
+		google::protobuf::Arena::CreateMessage<faiss_server::HSearchResponse>(&arena);
+	searchServer(index, wire, request, response, out);
+}
+
+typedef void (*SearchFunc)(const faiss::Index*, const std::string&, std::string*);
+
+static double allocsPerRequest(SearchFunc search, const faiss::Index *index,
+		const std::vector<std::string> &wires, long requests) {
+	//warm up, the search buffers and out grow once per thread, not per request
+	std::string out;
+	search(index, wires[0], &out);
+	allocs.store(0);
+	counting.store(true);
+	for (long i = 0; i < requests; i++) {
+		search(index, wires[i % wires.size()], &out);
+	}
+	counting.store(false);
+	return (double)allocs.load() / requests;
+}
+
+int main(int argc, char **argv) {
+	long requests = 10000;
+	if (argc > 1) {
+		requests = atol(argv[1]);
+	}
+	if (requests < 1) {
+		fprintf(stderr, "usage: %s [requests]\n", argv[0]);
+		return 1;
+	}
+	srand(1234);
+	std::vector<float> xb((size_t)NVectors * Dim);
+	for (size_t i = 0; i < xb.size(); i++) {
+		xb[i] = (float)rand() / RAND_MAX;
+	}
+	faiss::IndexFlatL2 index(Dim);
+	index.add(NVectors, xb.data());
+
+	//encoded requests as grpc hands them to the server
+	std::vector<std::string> wires(64);
+	for (size_t i = 0; i < wires.size(); i++) {
+		std::vector<float> query(Dim);
+		for (int j = 0; j < Dim; j++) {
+			query[j] = (float)rand() / RAND_MAX;
+		}
+		faiss_server::HSearchRequest request;
+		request.set_db_name("bench");
+		request.set_request_id("bench-" + std::to_string(i));
+		request.set_top_k(TopK);
+		request.set_threshold(Thresh);
+		request.set_feature((const char*)query.data(), Dim * sizeof(float));
+		request.SerializeToString(&wires[i]);
+	}
+
+	printf("HSearch d=%d ntotal=%d top_k=%d requests=%ld, index search not counted\n",
+			Dim, NVectors, TopK, requests);
+	printf("%-24s %8.2f allocs/request\n", "baseline (frozen copy)",
+			allocsPerRequest(searchBaseline, &index, wires, requests));
+	printf("%-24s %8.2f allocs/request\n", "sync server",
+			allocsPerRequest(searchSync, &index, wires, requests));
+	printf("%-24s %8.2f allocs/request\n", "async server",
+			allocsPerRequest(searchAsync, &index, wires, requests));
+	return 0;
+}
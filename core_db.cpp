@@ -1,5 +1,18 @@
 #include "core_db.h"
-LmDB::LmDB(std::string &db_name, size_t max_size):dbName(db_name),maxSize(max_size) {
+
+//dimension assumed until the index of the db is loaded
+static const int DefaultMapDimension = 512;
+//bytes of the tags of a feature, TagStore MaxTags
+static const size_t MaxTagBytes = 8 * sizeof(int32_t);
+//names of the IdDb sub-databases in the main database
+static const char *IdDbNames[IdDbs] = {"features", "tags"};
+
+LmdbOptions::LmdbOptions():durability(globalConfig.LmdbDurability),
+	writeMap(globalConfig.LmdbWriteMap),noReadahead(globalConfig.LmdbNoReadahead) {
+}
+
+LmDB::LmDB(std::string &db_name, size_t max_size, const LmdbOptions &options):
+	dbName(db_name),maxSize(max_size),options(options) {
 	m_env = NULL;
 	m_dbi = new MDB_dbi;
 	
@@ -40,18 +53,66 @@ LmDB::~LmDB() {
 	}
 }
 
-size_t LmDB::getMapSize() {
+size_t LmDB::getMapSize(int d) {
 	const size_t minSize = 100UL * 1024UL * 1024UL; /* minimal 100MB */
 	const size_t defaultSize = 4UL * 1024UL * 1024UL * 1024UL * 1024UL; /* maximum 4TB */
-	const size_t maxFeatureSize = sizeof(float) * 512;
-	const size_t itemSize = maxFeatureSize + 12;
+	const size_t pageSize = 4096, pageHeader = 16, nodeHeader = 8, keySize = sizeof(size_t);
 
 	if (maxSize == 0) {
 		return defaultSize;
-	} 
+	}
+	//a node bigger than half a page moves its value to overflow pages,
+	//leaf pages of random inserts are about half full
+	auto pageBytes = [&](size_t valSize) -> size_t {
+		size_t node = nodeHeader + keySize + valSize;
+		if (node <= (pageSize - pageHeader) / 2) {
+			return node * 2;
+		}
+		size_t pages = (valSize + pageHeader + pageSize - 1) / pageSize;
+		return pages * pageSize + (nodeHeader + keySize + sizeof(size_t)) * 2;
+	};
+	size_t itemSize = pageBytes(sizeof(float) * d) + pageBytes(MaxTagBytes);
 	return std::max(maxSize * itemSize, minSize);
 }
 
+//threads of main opening read txns: the db loading, persist, tune and lmdb sync threads
+static const unsigned int MainReaders = 4;
+//slots of the sync server threads, which serve every rpc without --async_server
+//and the streaming rpcs with it. grpc grows that pool with the open calls, so
+//it can not be derived: keep the 126 slots of the lmdb default the server ran
+//with, more concurrent calls need --lmdb_max_readers
+static const unsigned int SyncServerReaders = 126;
+
+unsigned int LmDB::maxReaders() {
+	if (globalConfig.LmdbMaxReaders > 0) {
+		return globalConfig.LmdbMaxReaders;
+	}
+	//a thread keeps its reader slot without MDB_NOTLS: one per thread of the
+	//fanout pool, the shared stream pool and the async server pools
+	unsigned int workers = globalConfig.FanoutWorkers + std::max(1, globalConfig.StreamWorkers);
+	if (globalConfig.AsyncServer) {
+		workers += globalConfig.CqThreads + globalConfig.SearchWorkers +
+			globalConfig.WriteWorkers + globalConfig.AdminWorkers;
+	}
+	return workers + MainReaders + SyncServerReaders;
+}
+
+int LmDB::setMapDimension(int d) {
+	size_t mapSize = getMapSize(d);
+	//lmdb keeps the map at least as big as the data
+	int rc = mdb_env_set_mapsize(m_env, mapSize);
+	LOG(INFO) << "db_name:" << dbName << " dim:" << d
+		<< " map_size:" << mapSize << " mdb_env_set_mapsize:" << rc;
+	return rc;
+}
+
+int LmDB::lmdbSync() {
+	if (!lmdbLazySync()) {
+		return 0;
+	}
+	return mdb_env_sync(m_env, 1);
+}
+
 int LmDB::initLmdb() {
 	if (dbName.length() < 1) {
 		LOG(WARNING) << "dbName is empty";
@@ -59,19 +120,36 @@ int LmDB::initLmdb() {
 	}
 	int rc = 0;
 	rc = mdb_env_create(&m_env);
-	rc = mdb_env_set_maxreaders(m_env, 100);
+	rc = mdb_env_set_maxreaders(m_env, maxReaders());
+	rc = mdb_env_set_maxdbs(m_env, IdDbs);
 	//rc = mdb_env_set_mapsize(m_env, 10485760);
-	rc = mdb_env_set_mapsize(m_env, getMapSize());
+	rc = mdb_env_set_mapsize(m_env, getMapSize(DefaultMapDimension));
+
+	unsigned int flags = 0;
+	if (LmdbNoSync == options.durability) {
+		flags |= MDB_NOSYNC;
+	} else if (LmdbNoMetaSync == options.durability) {
+		flags |= MDB_NOMETASYNC;
+	}
+	if (options.writeMap) {
+		flags |= MDB_WRITEMAP;
+	}
+	if (options.noReadahead) {
+		flags |= MDB_NORDAHEAD;
+	}
 	
 	std::ostringstream oss;
 	oss << "db_name:" << dbName
-		<< " lmdb_path:" << lmdbPath;
+		<< " lmdb_path:" << lmdbPath
+		<< " durability:" << options.durability
+		<< " write_map:" << options.writeMap
+		<< " no_readahead:" << options.noReadahead;
 	if (!mkFolder(lmdbPath)) {
 		oss << " error_msg: create dbPath failed";
 		LOG(WARNING) << oss.str();
 		return -1;
 	}
-	rc = mdb_env_open(m_env, lmdbPath.c_str(), 0, 0664);
+	rc = mdb_env_open(m_env, lmdbPath.c_str(), flags, 0664);
 
 	oss << " mdb_env_open:" << rc;
 	
@@ -130,6 +208,34 @@ int LmDB::lmdbSet(const char *key1, void *val1, int len1, const char *key2, void
 	return 0;
 }
 
+int LmDB::lmdbSetMulti(const char **keys, void **vals, const int *lens, size_t n) {
+	MDB_txn *txn = NULL;
+	int rc = mdb_txn_begin(m_env, NULL, 0, &txn);
+	if (rc != 0) {
+		LOG(WARNING) << "mdb_txn_begin failed:" << rc;
+		return rc;
+	}
+	MDB_val key, data;
+	for (size_t i = 0; i < n; i++) {
+		key.mv_size = strlen(keys[i]);
+		key.mv_data = const_cast<char*>(keys[i]);
+		data.mv_size = lens[i];
+		data.mv_data = vals[i];
+		rc = mdb_put(txn, *m_dbi, &key, &data, 0);
+		if (rc != 0) {
+			LOG(WARNING) << "put " << keys[i] << " to lmdb failed:" << rc;
+			mdb_txn_abort(txn);
+			return rc;
+		}
+	}
+	rc = mdb_txn_commit(txn);
+	if (rc != 0) {
+		LOG(WARNING) << "add multi-data to lmdb failed,id1:" << keys[0] << " n:" << n;
+		return rc;
+	}
+	return 0;
+}
+
 int LmDB::lmdbSet(const char *_key, void *_val, int len) {
 	MDB_txn *txn = NULL;
 	int rc = mdb_txn_begin(m_env, NULL, 0, &txn);
@@ -213,3 +319,288 @@ int LmDB::lmdbGet(const char *_key, std::string *_val, int *val_len) {
 	}
 	return rc;
 }
+int LmDB::lmdbGetBatch(const char **keys, size_t n, void *vals, size_t valLen, int *rcs) {
+	MDB_txn *txn = NULL;
+	int rc = mdb_txn_begin(m_env, NULL, MDB_RDONLY, &txn);
+	if (rc != 0) {
+		LOG(WARNING) << "mdb_txn_begin failed:" << rc;
+		return rc;
+	}
+
+	MDB_val key, data;
+	for (size_t i = 0; i < n; i++) {
+		key.mv_size = strlen(keys[i]);
+		key.mv_data = const_cast<char*>(keys[i]);
+
+		rcs[i] = mdb_get(txn, *m_dbi, &key, &data);
+		if (rcs[i] != 0) {
+			continue;
+		}
+		if (data.mv_size != valLen) {
+			rcs[i] = -1;
+			continue;
+		}
+		//data is only valid inside the transaction
+		memcpy((char*)vals + i * valLen, data.mv_data, valLen);
+	}
+	mdb_txn_abort(txn);	
+	return 0;
+}
+int LmDB::lmdbScan(const std::string &prefix,
+		std::function<void(const char *key, size_t keyLen, const void *val, size_t len)> fn) {
+	MDB_txn *txn = NULL;
+	int rc = mdb_txn_begin(m_env, NULL, MDB_RDONLY, &txn);
+	if (rc != 0) {
+		LOG(WARNING) << "mdb_txn_begin failed:" << rc;
+		return rc;
+	}
+	MDB_cursor *cursor = NULL;
+	rc = mdb_cursor_open(txn, *m_dbi, &cursor);
+	if (rc != 0) {
+		mdb_txn_abort(txn);
+		return rc;
+	}
+	MDB_val key, data;
+	key.mv_size = prefix.length();
+	key.mv_data = const_cast<char*>(prefix.data());
+	rc = mdb_cursor_get(cursor, &key, &data, MDB_SET_RANGE);
+	while (rc == 0) {
+		if (key.mv_size < prefix.length() ||
+				memcmp(key.mv_data, prefix.data(), prefix.length()) != 0) {
+			break;
+		}
+		fn((const char*)key.mv_data, key.mv_size, data.mv_data, data.mv_size);
+		rc = mdb_cursor_get(cursor, &key, &data, MDB_NEXT);
+	}
+	mdb_cursor_close(cursor);
+	mdb_txn_abort(txn);
+	return (rc == 0 || rc == MDB_NOTFOUND) ? 0 : rc;
+}
+
+int LmDB::openIdDbs() {
+	MDB_txn *txn = NULL;
+	int rc = mdb_txn_begin(m_env, NULL, 0, &txn);
+	if (rc != 0) {
+		LOG(WARNING) << "mdb_txn_begin failed:" << rc;
+		return rc;
+	}
+	for (int i = 0; i < IdDbs; i++) {
+		rc = mdb_dbi_open(txn, IdDbNames[i], MDB_CREATE | MDB_INTEGERKEY, &idDbis[i]);
+		if (rc != 0) {
+			LOG(WARNING) << "db_name:" << dbName << " open " << IdDbNames[i] << " failed:" << rc;
+			mdb_txn_abort(txn);
+			return rc;
+		}
+	}
+	return mdb_txn_commit(txn);
+}
+
+int LmDB::lmdbWrite(const LmdbPut *puts, size_t n) {
+	MDB_txn *txn = NULL;
+	int rc = mdb_txn_begin(m_env, NULL, 0, &txn);
+	if (rc != 0) {
+		LOG(WARNING) << "mdb_txn_begin failed:" << rc;
+		return rc;
+	}
+	MDB_val key, data;
+	for (size_t i = 0; i < n; i++) {
+		const LmdbPut &put = puts[i];
+		data.mv_size = put.len;
+		data.mv_data = const_cast<void*>(put.val);
+		if (put.key != NULL) {
+			key.mv_size = strlen(put.key);
+			key.mv_data = const_cast<char*>(put.key);
+			rc = mdb_put(txn, *m_dbi, &key, &data, 0);
+		} else {
+			key.mv_size = sizeof(size_t);
+			key.mv_data = const_cast<size_t*>(&put.id);
+			//ids mostly grow, MDB_APPEND fails before any change otherwise
+			rc = mdb_put(txn, idDbis[put.db], &key, &data, MDB_APPEND);
+			if (MDB_KEYEXIST == rc) {
+				rc = mdb_put(txn, idDbis[put.db], &key, &data, 0);
+			}
+		}
+		if (rc != 0) {
+			LOG(WARNING) << "put " << (put.key != NULL ? put.key : IdDbNames[put.db])
+				<< " id:" << put.id << " to lmdb failed:" << rc;
+			mdb_txn_abort(txn);
+			return rc;
+		}
+	}
+	rc = mdb_txn_commit(txn);
+	if (rc != 0) {
+		LOG(WARNING) << "write " << n << " records to lmdb failed:" << rc;
+		return rc;
+	}
+	return 0;
+}
+
+int LmDB::idGet(int db, size_t id, void **val, int *val_len) {
+	MDB_txn *txn = NULL;
+	int rc = mdb_txn_begin(m_env, NULL, MDB_RDONLY, &txn);
+	if (rc != 0) {
+		return rc;
+	}
+	MDB_val key, data;
+	key.mv_size = sizeof(size_t);
+	key.mv_data = &id;
+	rc = mdb_get(txn, idDbis[db], &key, &data);
+	mdb_txn_abort(txn);
+
+	if (rc == 0) {
+		*val = data.mv_data;
+		*val_len = data.mv_size;
+	}
+	return rc;
+}
+
+int LmDB::idGetBatch(int db, const long *ids, size_t n, void *vals, size_t valLen, int *rcs) {
+	MDB_txn *txn = NULL;
+	int rc = mdb_txn_begin(m_env, NULL, MDB_RDONLY, &txn);
+	if (rc != 0) {
+		LOG(WARNING) << "mdb_txn_begin failed:" << rc;
+		return rc;
+	}
+
+	MDB_val key, data;
+	size_t id;
+	key.mv_size = sizeof(size_t);
+	key.mv_data = &id;
+	for (size_t i = 0; i < n; i++) {
+		if (ids[i] < 0) {
+			rcs[i] = MDB_NOTFOUND;
+			continue;
+		}
+		id = ids[i];
+		rcs[i] = mdb_get(txn, idDbis[db], &key, &data);
+		if (rcs[i] != 0) {
+			continue;
+		}
+		if (data.mv_size != valLen) {
+			rcs[i] = -1;
+			continue;
+		}
+		//data is only valid inside the transaction
+		memcpy((char*)vals + i * valLen, data.mv_data, valLen);
+	}
+	mdb_txn_abort(txn);
+	return 0;
+}
+
+int LmDB::idDel(int db, size_t id) {
+	MDB_txn *txn = NULL;
+	int rc = mdb_txn_begin(m_env, NULL, 0, &txn);
+	if (rc != 0) {
+		return rc;
+	}
+	MDB_val key;
+	key.mv_size = sizeof(size_t);
+	key.mv_data = &id;
+	rc = mdb_del(txn, idDbis[db], &key, NULL);
+	if (rc != 0) {
+		mdb_txn_abort(txn);
+		return rc;
+	}
+	return mdb_txn_commit(txn);
+}
+
+int LmDB::idScan(int db, std::function<void(size_t id, const void *val, size_t len)> fn) {
+	MDB_txn *txn = NULL;
+	int rc = mdb_txn_begin(m_env, NULL, MDB_RDONLY, &txn);
+	if (rc != 0) {
+		LOG(WARNING) << "mdb_txn_begin failed:" << rc;
+		return rc;
+	}
+	MDB_cursor *cursor = NULL;
+	rc = mdb_cursor_open(txn, idDbis[db], &cursor);
+	if (rc != 0) {
+		mdb_txn_abort(txn);
+		return rc;
+	}
+	MDB_val key, data;
+	rc = mdb_cursor_get(cursor, &key, &data, MDB_FIRST);
+	while (rc == 0) {
+		size_t id;
+		memcpy(&id, key.mv_data, sizeof(size_t));
+		fn(id, data.mv_data, data.mv_size);
+		rc = mdb_cursor_get(cursor, &key, &data, MDB_NEXT);
+	}
+	mdb_cursor_close(cursor);
+	mdb_txn_abort(txn);
+	return rc == MDB_NOTFOUND ? 0 : rc;
+}
+
+int LmDB::lmdbMigrateIds(const std::string &prefix, int db, size_t batch, size_t *moved) {
+	*moved = 0;
+	//decimal ids of FIXLEN digits sort as numbers, the moved records are appended
+	while (true) {
+		MDB_txn *txn = NULL;
+		int rc = mdb_txn_begin(m_env, NULL, 0, &txn);
+		if (rc != 0) {
+			LOG(WARNING) << "mdb_txn_begin failed:" << rc;
+			return rc;
+		}
+		MDB_cursor *cursor = NULL;
+		rc = mdb_cursor_open(txn, *m_dbi, &cursor);
+		if (rc != 0) {
+			mdb_txn_abort(txn);
+			return rc;
+		}
+		size_t n = 0;
+		MDB_val key, data;
+		while (n < batch) {
+			//the first record left after the moved ones
+			if (prefix.empty()) {
+				rc = mdb_cursor_get(cursor, &key, &data, MDB_FIRST);
+			} else {
+				key.mv_size = prefix.length();
+				key.mv_data = const_cast<char*>(prefix.data());
+				rc = mdb_cursor_get(cursor, &key, &data, MDB_SET_RANGE);
+			}
+			if (rc != 0) {
+				break;
+			}
+			if (key.mv_size != prefix.length() + FIXLEN ||
+					memcmp(key.mv_data, prefix.data(), prefix.length()) != 0) {
+				break;
+			}
+			char idStr[FIXLEN + 1] = {'\0'};
+			memcpy(idStr, (char*)key.mv_data + prefix.length(), FIXLEN);
+			long id = decodeID(idStr);
+			if (id < 0) {
+				break;
+			}
+			MDB_val idKey;
+			size_t idVal = id;
+			idKey.mv_size = sizeof(size_t);
+			idKey.mv_data = &idVal;
+			rc = mdb_put(txn, idDbis[db], &idKey, &data, MDB_APPEND);
+			if (MDB_KEYEXIST == rc) {
+				rc = mdb_put(txn, idDbis[db], &idKey, &data, 0);
+			}
+			if (rc != 0) {
+				break;
+			}
+			rc = mdb_cursor_del(cursor, 0);
+			if (rc != 0) {
+				break;
+			}
+			n ++;
+		}
+		mdb_cursor_close(cursor);
+		if (rc != 0 && rc != MDB_NOTFOUND) {
+			LOG(WARNING) << "db_name:" << dbName << " migrate '" << prefix << "' ids failed:" << rc;
+			mdb_txn_abort(txn);
+			return rc;
+		}
+		if (0 == n) {
+			mdb_txn_abort(txn);
+			return 0;
+		}
+		rc = mdb_txn_commit(txn);
+		if (rc != 0) {
+			return rc;
+		}
+		*moved += n;
+	}
+}
@@ -0,0 +1,281 @@
+#include "db_tuner.h"
+#include <algorithm>
+#include <glog/logging.h>
+#include "faiss/utils.h"
+#include "faiss/Heap.h"
+#include "faiss/AutoTune.h"
+
+//number of sampled queries
+static const size_t TuneQueries = 100;
+//recall is measured at this k
+static const int TuneTopK = 10;
+//dbs smaller than this are not tuned
+static const size_t TuneMinSize = 1000;
+//features read from lmdb per transaction in the brute force scan
+static const size_t TuneChunk = 4096;
+
+DbTuner::DbTuner(FaissDB *db):db(db),nq(0) {
+	d = db->index->d;
+	ip = db->index->metric_type == faiss::METRIC_INNER_PRODUCT;
+}
+
+bool DbTuner::needTune(FaissDB *db) {
+	if (db->targetRecall <= 0) {
+		return false;
+	}
+	size_t ntotal = db->index->ntotal;
+	if (ntotal < TuneMinSize) {
+		return false;
+	}
+	TunedPoint point = db->tunedPoint();
+	//retune when the db doubled
+	return point.nprobe < 1 || ntotal >= 2 * point.ntotal;
+}
+
+size_t DbTuner::sampleQueries() {
+	long maxID = db->maxID.load(std::memory_order_relaxed);
+	std::vector<long> ids(TuneQueries);
+	faiss::RandomGenerator rng(maxID);
+	for (size_t i = 0; i < TuneQueries; i ++) {
+		ids[i] = 1 + rng.rand_long() % maxID;
+	}
+	std::vector<float> features(TuneQueries * d);
+	std::vector<int> rcs(TuneQueries);
+	if (db->getFeatures(ids.data(), TuneQueries, features.data(), rcs.data()) != 0) {
+		return 0;
+	}
+	//deleted ids are skipped
+	queries.clear();
+	for (size_t i = 0; i < TuneQueries; i ++) {
+		if (rcs[i] != 0) {
+			continue;
+		}
+		queries.insert(queries.end(), features.begin() + i * d, features.begin() + (i + 1) * d);
+	}
+	nq = queries.size() / d;
+	return nq;
+}
+
+int DbTuner::groundTruth(std::vector<float> *gtD, std::vector<faiss::Index::idx_t> *gtI) {
+	gtD->resize(nq * TuneTopK);
+	gtI->resize(nq * TuneTopK);
+	for (size_t q = 0; q < nq; q ++) {
+		if (ip) {
+			faiss::minheap_heapify(TuneTopK, gtD->data() + q * TuneTopK, gtI->data() + q * TuneTopK);
+		} else {
+			faiss::maxheap_heapify(TuneTopK, gtD->data() + q * TuneTopK, gtI->data() + q * TuneTopK);
+		}
+	}
+
+	long maxID = db->maxID.load(std::memory_order_relaxed);
+	std::vector<long> ids(TuneChunk);
+	std::vector<float> features(TuneChunk * d);
+	std::vector<int> rcs(TuneChunk);
+	for (long start = 1; start <= maxID; start += TuneChunk) {
+		if (db->dropped) {
+			return CANCELLED;
+		}
+		size_t n = std::min((long)TuneChunk, maxID - start + 1);
+		for (size_t i = 0; i < n; i ++) {
+			ids[i] = start + i;
+		}
+		int rc = db->getFeatures(ids.data(), n, features.data(), rcs.data());
+		if (rc != 0) {
+			return rc;
+		}
+		{
+			unique_readguard<WfirstRWLock> readlock(*(db->lock));
+			for (size_t i = 0; i < n; i ++) {
+				if (rcs[i] == 0 && db->inBlackList(ids[i])) {
+					rcs[i] = MDB_NOTFOUND;
+				}
+			}
+		}
+		for (size_t i = 0; i < n; i ++) {
+			if (rcs[i] != 0) {
+				continue;
+			}
+			const float *y = features.data() + i * d;
+			for (size_t q = 0; q < nq; q ++) {
+				const float *x = queries.data() + q * d;
+				float *simi = gtD->data() + q * TuneTopK;
+				long *idxi = gtI->data() + q * TuneTopK;
+				if (ip) {
+					float dis = faiss::fvec_inner_product(x, y, d);
+					if (dis > simi[0]) {
+						faiss::minheap_pop(TuneTopK, simi, idxi);
+						faiss::minheap_push(TuneTopK, simi, idxi, dis, ids[i]);
+					}
+				} else {
+					float dis = faiss::fvec_L2sqr(x, y, d);
+					if (dis < simi[0]) {
+						faiss::maxheap_pop(TuneTopK, simi, idxi);
+						faiss::maxheap_push(TuneTopK, simi, idxi, dis, ids[i]);
+					}
+				}
+			}
+		}
+	}
+
+	for (size_t q = 0; q < nq; q ++) {
+		if (ip) {
+			faiss::minheap_reorder(TuneTopK, gtD->data() + q * TuneTopK, gtI->data() + q * TuneTopK);
+		} else {
+			faiss::maxheap_reorder(TuneTopK, gtD->data() + q * TuneTopK, gtI->data() + q * TuneTopK);
+		}
+	}
+	return 0;
+}
+
+void DbTuner::searchAll(int nprobe, int refineFactor,
+		std::vector<float> *D, std::vector<faiss::Index::idx_t> *I) {
+	int candidates = refineFactor > 0 ? TuneTopK * refineFactor : TuneTopK;
+	std::vector<faiss::Index::idx_t> nns(candidates);
+	std::vector<float> dis(candidates);
+	std::vector<float> exact(candidates);
+	std::vector<int> rcs(candidates);
+	std::vector<std::pair<float, faiss::Index::idx_t> > nodes;
+	D->assign(nq * TuneTopK, 0);
+	I->assign(nq * TuneTopK, -1);
+
+	//one query per search, like HSearch
+	for (size_t q = 0; q < nq; q ++) {
+		const float *x = queries.data() + q * d;
+		db->searchIndex(1, x, candidates, nprobe, NULL, dis.data(), nns.data());
+		if (refineFactor > 0) {
+			int n = 0;
+			while (n < candidates && nns[n] >= 0) {
+				n ++;
+			}
+			db->refineDistances(x, nns.data(), n, exact.data(), rcs.data());
+			nodes.clear();
+			for (int i = 0; i < n; i ++) {
+				if (rcs[i] == 0) {
+					//inner products are negated to sort ascending
+					nodes.push_back(std::make_pair(ip ? -exact[i] : exact[i], nns[i]));
+				}
+			}
+			std::sort(nodes.begin(), nodes.end());
+			for (size_t i = 0; i < nodes.size() && i < (size_t)TuneTopK; i ++) {
+				(*D)[q * TuneTopK + i] = ip ? -nodes[i].first : nodes[i].first;
+				(*I)[q * TuneTopK + i] = nodes[i].second;
+			}
+			continue;
+		}
+		std::copy(dis.begin(), dis.begin() + TuneTopK, D->begin() + q * TuneTopK);
+		std::copy(nns.begin(), nns.begin() + TuneTopK, I->begin() + q * TuneTopK);
+	}
+}
+
+int DbTuner::tune() {
+	std::ostringstream oss;
+	oss << "cmd:tune_db"
+		<< " db_name:" << db->dbName
+		<< " target_recall:" << db->targetRecall
+		<< " ntotal:" << db->index->ntotal;
+	double t0 = faiss::getmillisecs();
+	size_t ntotal = db->index->ntotal;
+	if (sampleQueries() < 1) {
+		oss << " error_msg:no query sampled";
+		LOG(WARNING) << oss.str();
+		return NOT_FOUND;
+	}
+	std::vector<float> gtD;
+	std::vector<faiss::Index::idx_t> gtI;
+	int rc = groundTruth(&gtD, &gtI);
+	if (rc != 0) {
+		oss << " error_msg:ground truth failed:" << rc;
+		LOG(WARNING) << oss.str();
+		return rc;
+	}
+	oss << " nq:" << nq
+		<< " ground_truth_ms:" << faiss::getmillisecs() - t0;
+
+	faiss::IntersectionCriterion crit(nq, TuneTopK);
+	crit.set_groundtruth(TuneTopK, gtD.data(), gtI.data());
+
+	//values sorted from the cheapest, as ParameterSpace expects
+	faiss::ParameterSpace ps;
+	size_t nlist = 0;
+	{
+		unique_readguard<WfirstRWLock> readlock(*(db->lock));
+		nlist = db->backend->numLists();
+	}
+	std::vector<double> probeValues, refineValues;
+	size_t maxProbes = std::min(nlist, (size_t)std::max(globalConfig.MaxNProbes, globalConfig.NProbes));
+	for (size_t p = 1; p <= maxProbes; p *= 2) {
+		probeValues.push_back(p);
+	}
+	for (int f = 0; f <= MaxRefineFactor && f <= 16; f = (f == 0 ? 2 : f * 2)) {
+		refineValues.push_back(f);
+	}
+	//add_range may move the ranges added before, take the references after both
+	ps.add_range("nprobe").values = probeValues;
+	ps.add_range("refine_factor").values = refineValues;
+	const faiss::ParameterRange &probes = ps.parameter_ranges[0];
+	const faiss::ParameterRange &refines = ps.parameter_ranges[1];
+
+	faiss::OperatingPoints ops;
+	std::vector<float> D;
+	std::vector<faiss::Index::idx_t> I;
+	size_t np = probes.values.size();
+	for (size_t cno = 0; cno < ps.n_combinations(); cno ++) {
+		if (db->dropped) {
+			LOG(INFO) << oss.str() << " cancelled";
+			return CANCELLED;
+		}
+		//skip points that can not beat the frontier, like ParameterSpace::explore
+		double upperPerf = 1.0, lowerT = 0.0;
+		for (size_t i = 0; i < ops.all_pts.size(); i ++) {
+			ps.update_bounds(cno, ops.all_pts[i], &upperPerf, &lowerT);
+		}
+		if (lowerT > ops.t_for_perf(upperPerf)) {
+			continue;
+		}
+		//the first range varies fastest in a combination number
+		int nprobe = probes.values[cno % np];
+		int factor = refines.values[cno / np];
+		double t1 = faiss::getmillisecs();
+		searchAll(nprobe, factor, &D, &I);
+		double t = (faiss::getmillisecs() - t1) / nq;
+		double perf = crit.evaluate(D.data(), I.data());
+		ops.add(perf, t, ps.combination_name(cno), cno);
+		VLOG(50) << "db_name:" << db->dbName << " " << ps.combination_name(cno)
+			<< " recall:" << perf << " ms:" << t;
+	}
+
+	//optimal points are sorted by perf, and so by time
+	const faiss::OperatingPoint *chosen = NULL;
+	for (size_t i = 0; i < ops.optimal_pts.size(); i ++) {
+		chosen = &ops.optimal_pts[i];
+		if (chosen->perf >= db->targetRecall) {
+			break;
+		}
+	}
+	if (NULL == chosen || chosen->cno < 0) {
+		oss << " error_msg:no operating point";
+		LOG(WARNING) << oss.str();
+		return NOT_FOUND;
+	}
+	TunedPoint point;
+	point.nprobe = probes.values[chosen->cno % np];
+	point.refineFactor = refines.values[chosen->cno / np];
+	point.recall = chosen->perf;
+	point.latencyMs = chosen->t;
+	point.ntotal = ntotal;
+	rc = db->setTunedPoint(point);
+	oss << " explored:" << ops.all_pts.size()
+		<< " optimal:" << ops.optimal_pts.size()
+		<< " tuned_point:" << chosen->key
+		<< " recall:" << point.recall
+		<< " latency_ms:" << point.latencyMs
+		<< " total_ms:" << faiss::getmillisecs() - t0
+		<< " store_res:" << rc;
+	if (point.recall < db->targetRecall) {
+		oss << " msg:target recall not reached";
+		LOG(WARNING) << oss.str();
+		return rc;
+	}
+	LOG(INFO) << oss.str();
+	return rc;
+}
@@ -3,6 +3,7 @@
 #include <unistd.h>
 #include <grpc++/grpc++.h>
 #include "faiss_logic.h"
+#include "db_tuner.h"
 
 Status FaissServiceImpl::Ping(ServerContext* context, 
 		const ::faiss_server::PingRequest* request, 
@@ -19,6 +20,8 @@ void FaissServiceImpl::PersistIndexPeriod(FaissServiceImpl *handle,const unsigne
 			continue;
 		}
 		{
+			//waits for its turn before taking m_lock
+			AdmissionTicket ticket(handle->admission.get(), WorkPersist, NULL);
 			unique_readguard<WfirstRWLock> readlock(*(handle->m_lock));
 			auto *dbs = &(handle->dbs);
 			for (auto it = dbs->begin(); it != dbs->end(); it++) {
@@ -30,20 +33,73 @@ void FaissServiceImpl::PersistIndexPeriod(FaissServiceImpl *handle,const unsigne
 	}
 }
 
-int FaissServiceImpl::InitServer() {
-	cudaSetDevice(0);
-	m_resources = new StandardGpuResources;
-	if (NULL == m_resources) {
-		return -1;
+void FaissServiceImpl::SyncLmdbPeriod(FaissServiceImpl *handle, const unsigned int durationMs) {
+	while (true) {
+		std::this_thread::sleep_for(std::chrono::milliseconds(durationMs));
+
+		if (NULL == handle) {
+			continue;
+		}
+		unique_readguard<WfirstRWLock> readlock(*(handle->m_lock));
+		auto *dbs = &(handle->dbs);
+		for (auto it = dbs->begin(); it != dbs->end(); it++) {
+			auto db = it->second;
+			if (!db->lmdbLazySync()) {
+				continue;
+			}
+			int rc = db->lmdbSync();
+			if (rc != 0) {
+				LOG(WARNING) << "db_name:" << it->first << " lmdb sync failed:" << rc;
+			}
+		}
 	}
-	
+}
+
+void FaissServiceImpl::TuneDbsPeriod(FaissServiceImpl *handle, const unsigned int duration) {
+	std::set<std::string> tried;
+	while (true) {
+		std::this_thread::sleep_for (std::chrono::seconds(duration));
+
+		if (NULL == handle) {
+			continue;
+		}
+		//tune one db at a time, without holding m_lock while tuning;
+		//DbDel waits on tuneMutex of the db before deleting it
+		tried.clear();
+		while (true) {
+			FaissDB *db = NULL;
+			{
+				unique_readguard<WfirstRWLock> readlock(*(handle->m_lock));
+				auto *dbs = &(handle->dbs);
+				for (auto it = dbs->begin(); it != dbs->end(); it++) {
+					if (tried.count(it->first) > 0 || !DbTuner::needTune(it->second)) {
+						continue;
+					}
+					tried.insert(it->first);
+					db = it->second;
+					db->tuneMutex.lock();
+					break;
+				}
+			}
+			if (NULL == db) {
+				break;
+			}
+			DbTuner tuner(db);
+			tuner.tune();
+			db->tuneMutex.unlock();
+		}
+	}
+}
+
+int FaissServiceImpl::InitServer() {
 	m_lock = new WfirstRWLock;
 	if (NULL == m_lock) {
 		return -1;
 	}
-
-	gpu_lock = new WfirstRWLock;
-	if (NULL == gpu_lock) {
+	fanoutPool.reset(new WorkerPool("fanout", globalConfig.FanoutWorkers, globalConfig.FanoutQueue));
+	streamPool.reset(new WorkerPool("stream", std::max(1, globalConfig.StreamWorkers), globalConfig.StreamQueue));
+	admission.reset(new Admission());
+	if (admission->init(globalConfig.AdmissionLimits, globalConfig.WriteYieldMs) != 0) {
 		return -1;
 	}
 
@@ -86,21 +142,24 @@ int FaissServiceImpl::LoadLocalDBs() {
 		oss << " db_name:" << dbName;
 		
 		valStr.append((char*)data.mv_data, data.mv_size);
-		std::string modelPath, sizeStr;
-		pos = valStr.find(SDivide.c_str());
-		size_t maxSize = DefaultDBSize;
-		if (pos == std::string::npos) {
-			modelPath = valStr;
-		} else if (pos > 0) {
-			sizeStr = valStr.substr(pos + SDivide.length());
-			maxSize = atoi(sizeStr.c_str());
-			modelPath = valStr.substr(0, pos);
+		DbMeta meta;
+		meta.decode(valStr);
+		if (!validDevice(meta.device)) {
+			oss << " unsupported_device:" << meta.device;
+			meta.device = globalConfig.Device;
 		}
-		oss << " modelPath:" << modelPath 
-			<< " maxSize:" << maxSize;
+		oss << " modelPath:" << meta.modelPath 
+			<< " maxSize:" << meta.maxSize
+			<< " device:" << meta.device
+			<< " metric:" << meta.metric
+			<< " refineFactor:" << meta.refineFactor
+			<< " targetRecall:" << meta.targetRecall
+			<< " durability:" << meta.durability
+			<< " writeMap:" << meta.writeMap
+			<< " noReadahead:" << meta.noReadahead;
 		//插入新的db
-		FaissDB *db = new FaissDB(dbName, modelPath, maxSize, this->gpu_lock);
-		int rc = db->reload(m_resources);
+		FaissDB *db = new FaissDB(dbName, meta);
+		int rc = db->reload();
 		oss << " res:" << rc;
 		if (rc == ErrorCode::OK) {
 			dbs[dbName.c_str()] = db;
@@ -123,8 +182,15 @@ int FaissServiceImpl::LoadLocalDBs() {
 	return 0;
 }
 
-FaissServiceImpl::FaissServiceImpl():LmDB(SGlobalDBName,0),
-	m_resources(NULL), m_lock(NULL) {
+//the db metas are always synced
+static LmdbOptions globalDbOptions() {
+	LmdbOptions options;
+	options.durability = LmdbSync;
+	return options;
+}
+
+FaissServiceImpl::FaissServiceImpl():LmDB(SGlobalDBName,0,globalDbOptions()),
+	m_lock(NULL) {
 	int rc = InitServer();
 	if (rc != 0) {
 		LOG(FATAL) << "initialize FaissServiceImpl failed:" << rc;
@@ -133,5 +199,4 @@ FaissServiceImpl::FaissServiceImpl():LmDB(SGlobalDBName,0),
 }
 
 FaissServiceImpl::~FaissServiceImpl() {
-	delete m_resources;
 }
@@ -1,44 +1,174 @@
 #include "faiss_db.h"
+#include "faiss/utils.h"
 
-FaissDB::FaissDB(std::string &db_name, 
-		std::string &model_path,
-		size_t max_size,
-		WfirstRWLock *gpu_lock):LmDB(db_name,max_size),modelPath(model_path), lock(gpu_lock) {
+DbMeta::DbMeta():maxSize(DefaultDBSize),device(globalConfig.Device),
+	metric(faiss_server::DbNewRequest::L2),refineFactor(0),targetRecall(0),
+	durability(0),writeMap(false),noReadahead(false) {
+}
+
+LmdbOptions DbMeta::lmdbOptions() const {
+	LmdbOptions options;
+	if (durability > 0) {
+		options.durability = durability;
+	}
+	options.writeMap = options.writeMap || writeMap;
+	options.noReadahead = options.noReadahead || noReadahead;
+	return options;
+}
+
+std::string DbMeta::encode() const {
+	std::ostringstream oss;
+	oss << modelPath
+		<< SDivide << maxSize
+		<< SDivide << device
+		<< SDivide << (int)metric
+		<< SDivide << refineFactor
+		<< SDivide << targetRecall
+		<< SDivide << durability
+		<< SDivide << writeMap
+		<< SDivide << noReadahead;
+	return oss.str();
+}
+
+void DbMeta::decode(const std::string &val) {
+	std::vector<std::string> fields;
+	size_t start = 0;
+	while (true) {
+		size_t pos = val.find(SDivide, start);
+		if (pos == std::string::npos) {
+			fields.push_back(val.substr(start));
+			break;
+		}
+		fields.push_back(val.substr(start, pos - start));
+		start = pos + SDivide.length();
+	}
+	modelPath = fields[0];
+	if (fields.size() > 1) {
+		maxSize = atol(fields[1].c_str());
+	}
+	if (fields.size() > 2) {
+		device = fields[2];
+	}
+	if (fields.size() > 3) {
+		int m = atoi(fields[3].c_str());
+		if (faiss_server::DbNewRequest::MetricType_IsValid(m)) {
+			metric = (DbMetric)m;
+		}
+	}
+	if (fields.size() > 4) {
+		refineFactor = atoi(fields[4].c_str());
+	}
+	if (fields.size() > 5) {
+		targetRecall = atof(fields[5].c_str());
+	}
+	if (fields.size() > 6) {
+		int v = atoi(fields[6].c_str());
+		if (faiss_server::DbNewRequest::Durability_IsValid(v)) {
+			durability = v;
+		}
+	}
+	if (fields.size() > 7) {
+		writeMap = atoi(fields[7].c_str()) != 0;
+	}
+	if (fields.size() > 8) {
+		noReadahead = atoi(fields[8].c_str()) != 0;
+	}
+}
+
+TunedPoint::TunedPoint():nprobe(0),refineFactor(0),recall(0),latencyMs(0),ntotal(0) {
+}
+
+std::string TunedPoint::encode() const {
+	std::ostringstream oss;
+	oss << nprobe
+		<< SDivide << refineFactor
+		<< SDivide << recall
+		<< SDivide << latencyMs
+		<< SDivide << ntotal;
+	return oss.str();
+}
+
+int TunedPoint::decode(const std::string &val) {
+	int n = sscanf(val.c_str(), "%d##%d##%f##%f##%zu",
+			&nprobe, &refineFactor, &recall, &latencyMs, &ntotal);
+	return n == 5 ? 0 : -1;
+}
+
+FaissDB::FaissDB(std::string &db_name, const DbMeta &meta):LmDB(db_name,meta.maxSize,meta.lmdbOptions()),
+	device(meta.device),metric(meta.metric),refineFactor(meta.refineFactor),
+	targetRecall(meta.targetRecall),modelPath(meta.modelPath) {
+	lock = new WfirstRWLock;
 	index = NULL;
+	backend = NULL;
 	persistPath = "./data/" + db_name + ".index";
 	maxPersistID = 0;
 	maxID = 0;
 	writeFlag = true;
+	dropped = false;
+	writeEpoch = 0;
+	cache = NULL;
+	if (globalConfig.ResultCacheMB > 0) {
+		cache = new ResultCache((size_t)globalConfig.ResultCacheMB << 20);
+	}
+	groupWriter = NULL;
+	if (globalConfig.SetGroupSize > 1) {
+		groupWriter = new GroupWriter([this](const float *features, size_t n,
+					const int32_t *tags, size_t ntags, long *firstID) {
+				return this->addFeatures(features, n, tags, ntags, firstID);
+			}, globalConfig.SetGroupSize, globalConfig.SetGroupWaitUs);
+	}
+	wal = NULL;
+	ingestedID = 0;
+	ingestPending = 0;
+	ingestStopping = false;
+	if (!globalConfig.WalDir.empty()) {
+		wal = new Wal(globalConfig.WalDir + "/" + db_name,
+				(size_t)std::max(1, globalConfig.WalSegmentMB) << 20, globalConfig.WalSync);
+		if (wal->open() != 0) {
+			LOG(WARNING) << "db_name:" << db_name << " open wal failed, adds will fail";
+		}
+		ingester = std::thread(&FaissDB::ingestLoop, this);
+	}
+	batcher = new SearchBatcher([this](faiss::Index::idx_t n, const float *x,
+				faiss::Index::idx_t k, int nprobe, float *dis, faiss::Index::idx_t *nns) {
+			this->searchIndex(n, x, k, nprobe, NULL, dis, nns);
+		}, globalConfig.BatchWindowUs, globalConfig.BatchMaxSize);
+	if (openIdDbs() != 0) {
+		LOG(FATAL) << "open lmdb id databases failed";
+		exit(-1);
+	}
 }
 
 void FaissDB::status() {
-	int numList = this->index->getNumLists();
-	LOG(INFO) << "db_name:" << this->dbName << " num_list:" << numList;
 	std::ostringstream oss;
-
-	for (int i = 0; i < numList; i ++) {
-		int len = this->index->getListLength(i);
-		if (len > 0) {
-			oss << " 	list_id:" << i << " list_len:" << len << " list_idx:";
-			auto idx = this->index->getListIndices(i);
-			for (int j = 0; j < idx.size(); j ++) {
-				oss << idx[j] << ",";
-			}
-			oss << " list_codes:";
-			auto codes = this->index->getListCodes(i);
-			for (int j = 0; j < codes.size(); j ++) {
-				oss << uint32_t(codes[j]) << ",";
-			}
-		}		
-	}
+	oss << "db_name:" << this->dbName
+		<< " device:" << this->device;
+	this->backend->status(oss);
 	LOG(INFO) << oss.str();
 }
-int FaissDB::reload(StandardGpuResources *rs) {
+int FaissDB::reload() {
 	std::ostringstream oss;
 	bool rt = checkPathExists(this->persistPath);	
 	oss << "persist_path:" << this->persistPath
 		<< " is_exist:" << rt;
 	int rc = 0, rc2 = 0;
+	//records of the older decimal keys
+	rc = this->migrateKeys();
+	if (rc != 0) {
+		oss << " error_msg:migrate keys failed:" << rc;
+		LOG(WARNING) << oss.str();
+		return rc;
+	}
+	//a bad tuned point falls back to the defaults
+	rc2 = this->loadTunedPoint();
+	oss << " load_tuned_point:" << rc2;
+	rc = this->loadTags();
+	if (rc != 0) {
+		oss << " error_msg:load tags failed:" << rc;
+		LOG(WARNING) << oss.str();
+		return rc;
+	}
+	oss << " tag_columns:" << tags.size();
 	if (rt) {//持久化文件存在 
 		//加载黑名单
 		rc2 = this->loadBlackList(SBlackListKey.c_str());
@@ -49,7 +179,7 @@ int FaissDB::reload(StandardGpuResources *rs) {
 		}
 		oss << " load_blacklist:OK black_list_len:" << blackList.size();
 
-		rc = this->loadIndex(rs, this->persistPath);
+		rc = this->loadIndex(this->persistPath);
 		if (rc != 0) {
 			oss << " load_index:failed,resp:" << rc;
 			LOG(WARNING) << oss.str();
@@ -66,7 +196,7 @@ int FaissDB::reload(StandardGpuResources *rs) {
 	oss << " model_path:" << modelPath
 		<< " is_exist:" << rt;
 	if (rt) {//训练模型文件存在 
-		rc = this->loadIndex(rs, modelPath);
+		rc = this->loadIndex(modelPath);
 		oss << " load_index:" << (rc == 0 ? "OK":"FAILED");
 		if (rc != 0) {
 			LOG(WARNING) << oss.str();
@@ -74,16 +204,23 @@ int FaissDB::reload(StandardGpuResources *rs) {
 		}
 		// 考虑这种情况下，也可能存在删除黑名单,这将是非法数据
 		rc = lmdbDel(SBlackListKey.c_str());
-		if (rc == MDB_NOTFOUND) {
-			LOG(INFO) << oss.str();	
-			return 0;
-		} else if (rc != 0) {
+		if (rc != 0 && rc != MDB_NOTFOUND) {
 			oss << " delete_black_list:" << rc;
 			LOG(WARNING) << oss.str();	
 			return rc;
 		}
+		//the model index holds none of the features stored before the
+		//first persist, index them all and restore maxID
+		rc = lmdbDel(SPersistIDKey.c_str());
+		if (rc != 0 && rc != MDB_NOTFOUND) {
+			oss << " delete_persist_id:" << rc;
+			LOG(WARNING) << oss.str();
+			return rc;
+		}
+		rc = this->loadLostIndex();
+		oss << " load_lost_index:" << (rc == 0 ? "OK":"FAILED");
 		LOG(INFO) << oss.str();
-		return 0;
+		return rc;
 	}
 	LOG(WARNING) << oss.str();
 	return ErrorCode::NOT_FOUND;
@@ -94,6 +231,10 @@ int FaissDB::loadLostIndex() {
 	}
 	size_t maxID, maxPersistID;
 	int rc1, rc2;
+	//features acked by the wal but lost before their lmdb store
+	if (this->wal != NULL && (rc1 = this->replayWal()) != 0) {
+		return rc1;
+	}
 	rc1 = this->getID(SPersistIDKey.c_str(), &maxPersistID);
 	rc2 = this->getID(SMaxIDKey.c_str(), &maxID);
 	if (rc1 != 0 || rc2 != 0) {
@@ -103,6 +244,7 @@ int FaissDB::loadLostIndex() {
 	//读取成功
 	this->maxPersistID = maxPersistID;
 	this->maxID = maxID;
+	this->ingestedID = maxID;
 	std::ostringstream oss;
 	//db从lmdb中加载未持久化的数据
 	oss << "maxID:"<< maxID
@@ -142,7 +284,7 @@ int FaissDB::loadLostIndex() {
 		{
 			unique_writeguard<WfirstRWLock> writelock(*(this->lock));	
 			long _id = (long)id;
-			index->add_with_ids(1, feature, &_id);
+			backend->add(1, feature, &_id);
 		}
 	}
 	
@@ -151,15 +293,36 @@ int FaissDB::loadLostIndex() {
 	LOG(INFO) << oss.str();
 	return 0;
 }
-int FaissDB::loadIndex(StandardGpuResources *resources,std::string &idxPath) {
+int FaissDB::loadIndex(std::string &idxPath) {
 	std::ostringstream oss;
+	IndexBackend *backend = NULL;
 	try {
-		GpuIndexIVFPQConfig config;
-		config.device = 0;
+		oss << "idx_path:" << idxPath
+			<< " device:" << this->device;
+		backend = newIndexBackend(this->device);
+		if (NULL == backend) {
+			oss << " error_msg:index device not supported";
+			LOG(WARNING) << oss.str();
+			return -1;
+		}
 		faiss::Index *file_index = faiss::read_index(idxPath.c_str());
 		faiss::IndexIVFPQ *cpu_index = dynamic_cast<faiss::IndexIVFPQ *>(file_index);
-		oss << "idx_path:" << idxPath
-			<< " black_size:" << blackList.size()
+		if (NULL == cpu_index) {
+			oss << " error_msg:not an IndexIVFPQ";
+			delete file_index;
+			delete backend;
+			LOG(WARNING) << oss.str();
+			return -1;
+		}
+		if (metric == faiss_server::DbNewRequest::InnerProduct &&
+				cpu_index->metric_type != faiss::METRIC_INNER_PRODUCT) {
+			oss << " error_msg:model is not trained for inner product";
+			delete file_index;
+			delete backend;
+			LOG(WARNING) << oss.str();
+			return INVALID_ARGUMENT;
+		}
+		oss << " black_size:" << blackList.size()
 			<< " cpu_ntotal:" << cpu_index->ntotal
 			<< " nprobe:" << cpu_index->nprobe
 			<< " code_size:" << cpu_index->code_size;
@@ -181,45 +344,73 @@ int FaissDB::loadIndex(StandardGpuResources *resources,std::string &idxPath) {
 
 			//需要跟index一起，将blackList持久化,否则出现数据不一致
 			blackList.clear();
+			deleted.clear();
 			int rc = lmdbDel(SBlackListKey.c_str());
 			if (rc == MDB_NOTFOUND) {
 				//nothing
 			} else if (rc != 0) {
 				oss << " error_msg:delete blackList from lmdb failed:" << rc;
+				delete file_index;
+				delete backend;
 				LOG(WARNING) << oss.str();
 				return rc;
 			}
 			oss << " delete_black_list:ok";
 		}
 
+		//backend owns cpu_index from now on
+		file_index = NULL;
+		backend->load(cpu_index);
+		backend->setNumProbes(globalConfig.NProbes);
 		{
 			unique_writeguard<WfirstRWLock> writelock(*(this->lock));
-			this->index = new GpuIndexIVFPQ(resources, cpu_index, config);
-			this->index->setNumProbes(globalConfig.NProbes);
+			delete this->backend;
+			this->backend = backend;
+			this->index = backend->getIndex();
+			this->writeEpoch.fetch_add(1, std::memory_order_release);
 		}
 		oss << " dim:" << index->d
-			<< " gpu_ntotal:" << index->ntotal;
-		delete file_index;
-		file_index = NULL;
+			<< " ntotal:" << index->ntotal
+			<< " set_map_dimension:" << this->setMapDimension(index->d);
 		LOG(INFO) << oss.str();
 		return 0;
 	} catch(...) {
 		
 		oss << " error_msg:load index '"<< idxPath <<"' failed";
 		
-		if (this->index != NULL) {
-			delete this->index;
+		if (backend != NULL && backend != this->backend) {
+			delete backend;
 		}
-		this->index = NULL;
 		LOG(WARNING) << oss.str();
 	}
 	return -1;
 }
 
 FaissDB::~FaissDB() {
-	delete this->index;
+	//writes the queued features before the index goes
+	delete this->groupWriter;
+	this->groupWriter = NULL;
+	if (this->wal != NULL) {
+		//ingests the queued features, then the dropped db needs no wal
+		{
+			std::lock_guard<std::mutex> guard(ingestMutex);
+			ingestStopping = true;
+		}
+		condIngest.notify_one();
+		ingester.join();
+		wal->destroy();
+		delete this->wal;
+		this->wal = NULL;
+	}
+	delete this->batcher;
+	this->batcher = NULL;
+	delete this->cache;
+	this->cache = NULL;
+	delete this->backend;
+	this->backend = NULL;
 	this->index = NULL;
-	//lock can't be delete;
+	delete this->lock;
+	this->lock = NULL;
 	
 	//remove index file
 	if (!checkPathExists(persistPath)) {
@@ -233,28 +424,195 @@ FaissDB::~FaissDB() {
 }
 
 bool FaissDB::inBlackList(long feaID) {
-	if (blackList.find(feaID) != blackList.end()) {
-		return true;
+	return deleted.contains(feaID);
+}
+
+size_t FaissDB::blackListSize() {
+	return deleted.size();
+}
+
+void FaissDB::normalize(float *x, size_t n) {
+	if (metric != faiss_server::DbNewRequest::Cosine) {
+		return;
 	}
-	return false;
+	faiss::fvec_renorm_L2(index->d, n, x);
 }
 
-int FaissDB::calcCosine(const float *p1, long id, float *dis) {
-	float *feature = NULL;
-	size_t feaLen = 0;
-	int rc = getFeature(id, &feature, &feaLen); 
+const float *FaissDB::prepareQueries(const std::string &bytes, size_t n, std::vector<float> *buf) {
+	if (metric != faiss_server::DbNewRequest::Cosine) {
+		return floatView(bytes, buf);
+	}
+	//the request is const, normalize a copy
+	buf->resize(n * index->d);
+	memcpy(buf->data(), bytes.data(), buf->size() * sizeof(float));
+	normalize(buf->data(), n);
+	return buf->data();
+}
+
+float FaissDB::toScore(float dis) {
+	if (metric != faiss_server::DbNewRequest::Cosine ||
+			index->metric_type == faiss::METRIC_INNER_PRODUCT) {
+		return dis;
+	}
+	//squared L2 distance of unit vectors: |x-y|^2 = 2 - 2cos(x,y)
+	return 1.0f - dis / 2.0f;
+}
+
+float FaissDB::toDistance(float score) {
+	if (metric != faiss_server::DbNewRequest::Cosine ||
+			index->metric_type == faiss::METRIC_INNER_PRODUCT) {
+		return score;
+	}
+	return 2.0f - 2.0f * score;
+}
+
+int FaissDB::rangeSearch(const float *x, float radius, size_t maxResults, int nprobe,
+		const ScanStop *stop, faiss::RangeSearchResult *res, bool *truncated) {
+	unique_readguard<WfirstRWLock> readlock(*(this->lock));
+	ScanParams params;
+	params.nprobe = nprobe;
+	params.deleted = &deleted;
+	params.stop = stop;
+	return this->backend->rangeSearch(1, x, radius, maxResults, params, res, truncated);
+}
+
+void FaissDB::searchIndex(faiss::Index::idx_t n, const float *x, faiss::Index::idx_t k,
+		int nprobe, const ScanStop *stop, float *dis, faiss::Index::idx_t *nns) {
+	//searches run in parallel, add/persist/reload wait for them
+	unique_readguard<WfirstRWLock> readlock(*(this->lock));
+	ScanParams params;
+	params.nprobe = nprobe;
+	params.deleted = &deleted;
+	params.stop = stop;
+	this->backend->search(n, x, k, params, dis, nns);
+}
+
+void FaissDB::searchParams(int *nprobe, int *refineFactor) {
+	unique_readguard<WfirstRWLock> readlock(*(this->lock));
+	if (*nprobe <= 0) {
+		*nprobe = tuned.nprobe;
+	}
+	if (*refineFactor <= 0) {
+		*refineFactor = tuned.nprobe > 0 ? tuned.refineFactor : this->refineFactor;
+	}
+}
+
+TunedPoint FaissDB::tunedPoint() {
+	unique_readguard<WfirstRWLock> readlock(*(this->lock));
+	return tuned;
+}
+
+int FaissDB::setTunedPoint(const TunedPoint &point) {
+	{
+		unique_writeguard<WfirstRWLock> writelock(*(this->lock));
+		tuned = point;
+	}
+	std::string val = point.encode();
+	return lmdbSet(STunedPointKey.c_str(), (void*)val.data(), val.length());
+}
+
+int FaissDB::loadTunedPoint() {
+	std::string val;
+	int len = 128;
+	int rc = lmdbGet(STunedPointKey.c_str(), &val, &len);
+	if (MDB_NOTFOUND == rc) {
+		return 0;
+	} else if (rc != 0) {
+		return rc;
+	}
+	TunedPoint point;
+	if (point.decode(val.substr(0, len)) != 0) {
+		LOG(WARNING) << "db_name:" << dbName << " bad tuned point:" << val;
+		return -1;
+	}
+	unique_writeguard<WfirstRWLock> writelock(*(this->lock));
+	tuned = point;
+	return 0;
+}
+
+int FaissDB::searchOne(const float *x, faiss::Index::idx_t k, int nprobe, const ScanStop *stop,
+		float *dis, faiss::Index::idx_t *nns) {
+	//a batch can not stop for one of its queries
+	if (stop != NULL && !this->batcher->enabled()) {
+		searchDirect(x, k, nprobe, NULL, stop, dis, nns);
+		return 0;
+	}
+	return this->batcher->search(x, this->index->d, k, nprobe, dis, nns);
+}
+
+void FaissDB::searchDirect(const float *x, faiss::Index::idx_t k, int nprobe,
+		const std::vector<TagFilter> *filters, const ScanStop *stop,
+		float *dis, faiss::Index::idx_t *nns) {
+	unique_readguard<WfirstRWLock> readlock(*(this->lock));
+	TagPredicate pred(&tags, filters);
+	ScanParams params;
+	params.nprobe = nprobe;
+	params.deleted = &deleted;
+	params.filter = (filters != NULL && filters->size() > 0) ? &pred : NULL;
+	params.stop = stop;
+	this->backend->search(1, x, k, params, dis, nns);
+}
+
+int FaissDB::getFeatures(const long *ids, size_t n, float *features, int *rcs) {
+	int d = index->d;
+	int rc = idGetBatch(IdFeatures, ids, n, features, sizeof(float) * d, rcs);
 	if (rc != 0) {
 		return rc;
 	}
-	if (feaLen != index->d) {
-		return DIMENSION_NOT_EQUAL;
+	for (size_t i = 0; i < n; i ++) {
+		if (rcs[i] == -1) {
+			rcs[i] = DIMENSION_NOT_EQUAL;
+		}
 	}
+	return 0;
+}
 
-	*dis = cosine(p1, feature, index->d);
+int FaissDB::calcCosines(const float *p1, const long *ids, size_t n, float *dis, int *rcs) {
+	if (n < 1) {
+		return 0;
+	}
+	int d = index->d;
+	std::vector<float> features(n * d);
+	int rc = getFeatures(ids, n, features.data(), rcs);
+	if (rc != 0) {
+		return rc;
+	}
+	//missing features are scored too, their scores are ignored
+	cosineBatch(p1, features.data(), n, d, dis);
+	return 0;
+}
+
+int FaissDB::refineDistances(const float *p1, const long *ids, size_t n, float *dis, int *rcs) {
+	if (n < 1) {
+		return 0;
+	}
+	int d = index->d;
+	std::vector<float> features(n * d);
+	int rc = getFeatures(ids, n, features.data(), rcs);
+	if (rc != 0) {
+		return rc;
+	}
+	//same metric as the index, so that refined distances keep
+	//the meaning of EuclidThresh and toScore
+	bool ip = index->metric_type == faiss::METRIC_INNER_PRODUCT;
+	for (size_t i = 0; i < n; i ++) {
+		const float *y = features.data() + i * d;
+		dis[i] = ip ? faiss::fvec_inner_product(p1, y, d) : faiss::fvec_L2sqr(p1, y, d);
+	}
 	return 0;
 }
 	
-int FaissDB::addFeature(float *feature, const size_t len, long *id) {
+int FaissDB::addFeature(const float *feature, const size_t len, const int32_t *tags, size_t ntags, long *id) {
+	//Cosine dbs store and index the normalized feature
+	std::vector<float> normalized;
+	if (metric == faiss_server::DbNewRequest::Cosine) {
+		normalized.assign(feature, feature + len);
+		normalize(normalized.data(), 1);
+		feature = normalized.data();
+	}
+	if (this->wal != NULL) {
+		return appendWal(feature, 1, tags, ntags, id);
+	}
 	//add feature to index
 	{
 		unique_writeguard<WfirstRWLock> writelock(*(this->lock));
@@ -264,25 +622,297 @@ int FaissDB::addFeature(float *feature, const size_t len, long *id) {
 		}
 		(this->maxID).fetch_add(1, std::memory_order_relaxed);
 		*id = (this->maxID).load(std::memory_order_relaxed);
-		this->index->add_with_ids(1, feature, id);
+		this->backend->add(1, feature, id);
+		if (ntags > 0) {
+			this->tags.set(*id, tags, ntags);
+		}
 		this->writeFlag = true;
+		this->writeEpoch.fetch_add(1, std::memory_order_release);
 	}
-	//add feature and maxID to lmdb
-	char feaID[20] = {'\0'};
-	char maxIDVal[20] = {'\0'};
-	encodeID(feaID, *id);
+	//add feature, its tags and maxID to lmdb in one transaction
+	return storeFeatures(feature, 1, tags, ntags, *id);
+}
 
-	sprintf(maxIDVal, "%ld", *id);
-	return lmdbSet(feaID, feature, sizeof(float)*len, 
-			SMaxIDKey.c_str(), maxIDVal, strlen(maxIDVal));
+int FaissDB::addFeatures(const float *features, size_t n, const int32_t *tags, size_t ntags, long *firstID) {
+	if (n < 1) {
+		return INVALID_ARGUMENT;
+	}
+	size_t d = index->d;
+	std::vector<float> normalized;
+	if (metric == faiss_server::DbNewRequest::Cosine) {
+		normalized.assign(features, features + n * d);
+		normalize(normalized.data(), n);
+		features = normalized.data();
+	}
+	if (this->wal != NULL) {
+		return appendWal(features, n, tags, ntags, firstID);
+	}
+	std::vector<long> ids(n);
+	{
+		unique_writeguard<WfirstRWLock> writelock(*(this->lock));
+		if (index->ntotal + n > this->maxSize) {
+			return EXCEEDS_MAX_SIZE;
+		}
+		*firstID = (this->maxID).fetch_add(n, std::memory_order_relaxed) + 1;
+		for (size_t i = 0; i < n; i ++) {
+			ids[i] = *firstID + i;
+		}
+		this->backend->add(n, features, ids.data());
+		for (size_t i = 0; ntags > 0 && i < n; i ++) {
+			this->tags.set(ids[i], tags + i * ntags, ntags);
+		}
+		this->writeFlag = true;
+		this->writeEpoch.fetch_add(1, std::memory_order_release);
+	}
+	return storeFeatures(features, n, tags, ntags, *firstID);
+}
+
+int FaissDB::storeFeatures(const float *features, size_t n, const int32_t *tags, size_t ntags, long firstID) {
+	size_t d = index->d;
+	//all features, their tags and MAX_ID in one transaction
+	std::vector<LmdbPut> puts;
+	puts.reserve((ntags > 0 ? 2 * n : n) + 1);
+	for (size_t i = 0; i < n; i ++) {
+		puts.push_back(LmdbPut(IdFeatures, firstID + i, features + i * d, sizeof(float) * d));
+		if (ntags > 0) {
+			puts.push_back(LmdbPut(IdTags, firstID + i, tags + i * ntags, sizeof(int32_t) * ntags));
+		}
+	}
+	char maxIDVal[24] = {'\0'};
+	sprintf(maxIDVal, "%ld", firstID + (long)n - 1);
+	puts.push_back(LmdbPut(SMaxIDKey.c_str(), maxIDVal, strlen(maxIDVal)));
+	return lmdbWrite(puts.data(), puts.size());
+}
+
+int FaissDB::appendWal(const float *features, size_t n, const int32_t *tags, size_t ntags, long *firstID) {
+	size_t d = index->d;
+	IngestBatch batch;
+	batch.n = n;
+	batch.ntags = ntags;
+	batch.features.assign(features, features + n * d);
+	if (ntags > 0) {
+		batch.tags.assign(tags, tags + n * ntags);
+	}
+	//ids are allocated and appended in the same order
+	std::lock_guard<std::mutex> walGuard(walMutex);
+	{
+		std::unique_lock<std::mutex> ulk(ingestMutex);
+		//wait for the ingester when too far behind
+		size_t maxQueue = std::max(1, globalConfig.IngestQueue);
+		condIngested.wait(ulk, [&]()->bool {return ingestPending == 0 || ingestPending + n <= maxQueue; });
+	}
+	{
+		//the ingester moves features from ingestPending to the index
+		//under the writelock, lock order: db lock, ingestMutex
+		unique_readguard<WfirstRWLock> readlock(*(this->lock));
+		std::lock_guard<std::mutex> guard(ingestMutex);
+		if (index->ntotal + ingestPending + n > this->maxSize) {
+			return EXCEEDS_MAX_SIZE;
+		}
+	}
+	batch.firstID = (this->maxID).fetch_add(n, std::memory_order_relaxed) + 1;
+	//a failed append leaves a gap of ids
+	if (wal->append(batch.firstID, batch.features.data(), n, d,
+				ntags > 0 ? batch.tags.data() : NULL, ntags) != 0) {
+		return INTERNAL;
+	}
+	*firstID = batch.firstID;
+	{
+		std::lock_guard<std::mutex> guard(ingestMutex);
+		ingestPending += n;
+		ingestQueue.push_back(std::move(batch));
+	}
+	condIngest.notify_one();
+	return 0;
 }
-int FaissDB::getFeature(const size_t feaID, float **feature, size_t *len) {
-	char keyData[20] = {'\0'};
-	encodeID(keyData, feaID);
 
+void FaissDB::ingestLoop() {
+	std::vector<IngestBatch> batches;
+	std::vector<float> features;
+	std::vector<int32_t> tags;
+	std::vector<long> ids;
+	size_t maxBatch = std::max(1, globalConfig.IngestBatch);
+	while (true) {
+		batches.clear();
+		{
+			std::unique_lock<std::mutex> ulk(ingestMutex);
+			condIngest.wait(ulk, [this]()->bool {return ingestStopping || !ingestQueue.empty(); });
+			if (ingestQueue.empty()) {
+				return;
+			}
+			//contiguous ids only, a failed append leaves a gap
+			size_t n = 0;
+			while (!ingestQueue.empty() && (n == 0 || (n + ingestQueue.front().n <= maxBatch &&
+						ingestQueue.front().firstID == batches.back().firstID + (long)batches.back().n))) {
+				n += ingestQueue.front().n;
+				batches.push_back(std::move(ingestQueue.front()));
+				ingestQueue.pop_front();
+			}
+		}
+		size_t d = index->d;
+		size_t n = 0, ntags = 0;
+		for (size_t i = 0; i < batches.size(); i ++) {
+			n += batches[i].n;
+			ntags = std::max(ntags, batches[i].ntags);
+		}
+		long firstID = batches[0].firstID;
+		features.resize(n * d);
+		tags.assign(n * ntags, 0);
+		ids.resize(n);
+		size_t off = 0;
+		for (size_t i = 0; i < batches.size(); i ++) {
+			const IngestBatch &b = batches[i];
+			std::copy(b.features.begin(), b.features.end(), features.begin() + off * d);
+			for (size_t j = 0; j < b.n && b.ntags > 0; j ++) {
+				std::copy(b.tags.begin() + j * b.ntags, b.tags.begin() + (j + 1) * b.ntags,
+						tags.begin() + (off + j) * ntags);
+			}
+			off += b.n;
+		}
+		for (size_t i = 0; i < n; i ++) {
+			ids[i] = firstID + i;
+		}
+		//lmdb first, a searchable id always has its raw feature.
+		//the features stay in the wal until stored
+		int rc = 0;
+		while ((rc = storeFeatures(features.data(), n, ntags > 0 ? tags.data() : NULL, ntags, firstID)) != 0) {
+			LOG(ERROR) << "db_name:" << dbName << " ingest first_id:" << firstID
+				<< " n:" << n << " store features failed:" << rc << ", retry";
+			if (ingestStopping) {
+				return;
+			}
+			std::this_thread::sleep_for(std::chrono::seconds(1));
+		}
+		{
+			unique_writeguard<WfirstRWLock> writelock(*(this->lock));
+			this->backend->add(n, features.data(), ids.data());
+			for (size_t i = 0; ntags > 0 && i < n; i ++) {
+				this->tags.set(ids[i], tags.data() + i * ntags, ntags);
+			}
+			this->writeFlag = true;
+			this->writeEpoch.fetch_add(1, std::memory_order_release);
+			this->ingestedID.store(firstID + (long)n - 1, std::memory_order_release);
+			std::lock_guard<std::mutex> guard(ingestMutex);
+			ingestPending -= n;
+		}
+		condIngested.notify_all();
+	}
+}
+
+int FaissDB::waitIngested(long id, const ScanStop *stop) {
+	if (NULL == this->wal || this->ingestedID.load(std::memory_order_acquire) >= id) {
+		return 0;
+	}
+	auto until = std::chrono::steady_clock::now() + std::chrono::milliseconds(globalConfig.IngestWaitMs);
+	std::unique_lock<std::mutex> ulk(ingestMutex);
+	while (this->ingestedID.load(std::memory_order_acquire) < id) {
+		if ((stop != NULL && stop->stop()) || std::chrono::steady_clock::now() >= until) {
+			return DEADLINE_EXCEEDED;
+		}
+		condIngested.wait_for(ulk, std::chrono::milliseconds(5));
+	}
+	return 0;
+}
+
+int FaissDB::replayWal() {
+	size_t storedID = 0;
+	int rc = getID(SMaxIDKey.c_str(), &storedID);
+	if (rc != 0) {
+		return rc;
+	}
+	//the ingester stores in id order and deletes wait for it, so the
+	//records after MAX_ID are exactly the features lost before ingestion
+	size_t d = index->d;
+	std::vector<float> features;
+	std::vector<int32_t> tags;
+	long firstID = 0;
+	size_t n = 0, ntags = 0, replayed = 0;
+	auto flush = [&]() -> int {
+		if (n < 1) {
+			return 0;
+		}
+		int res = storeFeatures(features.data(), n, ntags > 0 ? tags.data() : NULL, ntags, firstID);
+		if (res != 0) {
+			return res;
+		}
+		if (ntags > 0) {
+			unique_writeguard<WfirstRWLock> writelock(*(this->lock));
+			for (size_t i = 0; i < n; i ++) {
+				this->tags.set(firstID + i, tags.data() + i * ntags, ntags);
+			}
+		}
+		replayed += n;
+		n = 0;
+		features.clear();
+		tags.clear();
+		return 0;
+	};
+	rc = wal->replay(storedID, [&](long id, const float *feature, int dim,
+				const int32_t *t, size_t nt) -> int {
+			if ((size_t)dim != d) {
+				LOG(WARNING) << "db_name:" << dbName << " wal record " << id << " dimension:" << dim;
+				return 0;
+			}
+			if (n > 0 && (id != firstID + (long)n || nt != ntags || n >= (size_t)globalConfig.IngestBatch)) {
+				int res = flush();
+				if (res != 0) {
+					return res;
+				}
+			}
+			if (0 == n) {
+				firstID = id;
+				ntags = nt;
+			}
+			features.insert(features.end(), feature, feature + d);
+			tags.insert(tags.end(), t, t + nt);
+			n ++;
+			return 0;
+		});
+	if (0 == rc) {
+		rc = flush();
+	}
+	LOG(INFO) << "db_name:" << dbName << " replay wal after:" << storedID
+		<< " replayed:" << replayed << " rc:" << rc;
+	return rc;
+}
+
+int FaissDB::migrateKeys() {
+	const size_t batch = 10000;
+	size_t features = 0, tagged = 0;
+	int rc = lmdbMigrateIds("", IdFeatures, batch, &features);
+	if (0 == rc) {
+		rc = lmdbMigrateIds(STagPrefix, IdTags, batch, &tagged);
+	}
+	if (features > 0 || tagged > 0 || rc != 0) {
+		LOG(INFO) << "db_name:" << dbName << " migrate keys features:" << features
+			<< " tags:" << tagged << " rc:" << rc;
+	}
+	return rc;
+}
+
+int FaissDB::loadTags() {
+	TagStore store;
+	size_t n = 0;
+	int rc = idScan(IdTags, [&](size_t id, const void *val, size_t len) {
+			//values may be unaligned
+			int32_t tags[MaxTags];
+			size_t ntags = std::min(len / sizeof(int32_t), (size_t)MaxTags);
+			memcpy(tags, val, ntags * sizeof(int32_t));
+			store.set(id, tags, ntags);
+			n ++;
+		});
+	if (rc != 0) {
+		return rc;
+	}
+	unique_writeguard<WfirstRWLock> writelock(*(this->lock));
+	tags = store;
+	VLOG(50) << "db_name:" << dbName << " tagged features:" << n;
+	return 0;
+}
+int FaissDB::getFeature(const size_t feaID, float **feature, size_t *len) {
 	void *fea = NULL;
 	int fea_len;
-	int rc = this->lmdbGet(keyData, &fea, &fea_len);
+	int rc = this->idGet(IdFeatures, feaID, &fea, &fea_len);
 	if (rc != 0) {
 		return rc;
 	}
@@ -291,6 +921,10 @@ int FaissDB::getFeature(const size_t feaID, float **feature, size_t *len) {
 	return 0;
 }
 int FaissDB::delFeature(const size_t feaID){
+	//the feature should be in lmdb, or replay would bring it back
+	if (feaID <= (this->maxID).load(std::memory_order_relaxed) && waitIngested(feaID, NULL) != 0) {
+		return DEADLINE_EXCEEDED;
+	}
 	//检查黑名单是否存在该id
 	unique_writeguard<WfirstRWLock> writelock(*(this->lock));
 	std::set<long>::iterator it;
@@ -300,9 +934,7 @@ int FaissDB::delFeature(const size_t feaID){
 		return grpc::StatusCode::ALREADY_EXISTS;
 	}
 
-	char key[20] = {'\0'};
-	encodeID(key, feaID);
-	int rc = this->lmdbDel(key);
+	int rc = this->idDel(IdFeatures, feaID);
 	if (MDB_NOTFOUND == rc) {
 		return grpc::StatusCode::ALREADY_EXISTS;
 	} else if (rc != 0) {
@@ -310,6 +942,8 @@ int FaissDB::delFeature(const size_t feaID){
 	}
 	//删除成功, 添加黑名单
 	blackList->insert(feaID);
+	deleted.set(feaID);
+	this->writeEpoch.fetch_add(1, std::memory_order_release);
 
 	//持久化黑名单
 	rc = this->storeBlackList(SBlackListKey.c_str());
@@ -346,6 +980,10 @@ int FaissDB::loadBlackList(const char *key) {
 	}
 	
 	blackList = std::set<long> ((long*)ids, (long*)ids + len);
+	deleted.clear();
+	for (auto it = blackList.begin(); it != blackList.end(); ++it) {
+		deleted.set(*it);
+	}
 
 	return 0;
 }
@@ -363,7 +1001,7 @@ int FaissDB::getID(const char *key, size_t *id) {
 	} else if (rc != 0) {
 		LOG(WARNING) << "get '" << key << "' failed:" << rc;
 		return rc;
-	} else if (len < 1 || len > 10 /*代表10^10的数量大小*/) {
+	} else if (len < 1 || len > 19 /*int64*/) {
 		LOG(WARNING)<< "get '" << key << "' failed: value to long(" << len << ")";
 		return -1;
 	}
@@ -377,7 +1015,7 @@ int FaissDB::getID(const char *key, size_t *id) {
 		}
 	}
 
-	*id = atoi(data);
+	*id = strtoull(data, NULL, 10);
 	return 0;
 }
 
@@ -391,19 +1029,19 @@ int FaissDB::persistIndex() {
 	}
 	{
 		unique_writeguard<WfirstRWLock> writelock(*(this->lock));
-		auto cpu_index = faiss::gpu::index_gpu_to_cpu (this->index);
 		oss << "cmd:auto_persist_index"
 			<< " db_name:" << this->dbName
 			<< " max_persist_id:" << this->maxPersistID
 			<< " max_id:" << (this->maxID).load(std::memory_order_relaxed);
 
-		write_index(cpu_index, (this->persistPath).c_str());
+		this->backend->write(this->persistPath);
 		//TODO 将黑名单中的ids顺便删除再持久化
 		//同时将index重新reload一次
 		this->writeFlag = false;
-		this->maxPersistID = (this->maxID).load(std::memory_order_relaxed);
+		//ids up to ingestedID are in the index, the rest still in the wal
+		this->maxPersistID = this->wal != NULL ? this->ingestedID.load(std::memory_order_acquire) :
+			(this->maxID).load(std::memory_order_relaxed);
 		persistID = this->maxPersistID;
-		delete cpu_index;
 		oss << " persist_path:" << this->persistPath;
 	}
 
@@ -411,9 +1049,21 @@ int FaissDB::persistIndex() {
 	//add时，将maxID写入lmdb中， del不需要写
 	char val[20] = {'\0'};
 
+	//the features up to persistID should be durable in lmdb before
+	//PERSIST_ID says so, and before the wal drops them
+	int rc = lmdbSync();
+	if (rc != 0) {
+		oss << " lmdb_sync:" << rc;
+		LOG(WARNING) << oss.str();
+		return rc;
+	}
 	sprintf(val, "%ld", persistID);
-	int rc = lmdbSet(SPersistIDKey.c_str(), val);
+	rc = lmdbSet(SPersistIDKey.c_str(), val);
 	oss << " set_lmdb:" << rc;
+	if (0 == rc && this->wal != NULL) {
+		std::lock_guard<std::mutex> walGuard(walMutex);
+		wal->truncate(persistID);
+	}
 	LOG(INFO) << oss.str();
 	return 0;
 }
\ No newline at end of file
@@ -2,24 +2,55 @@
 #include <stdio.h>
 #include <grpc++/grpc++.h>
 #include "faiss_logic.h"
+#include "access_log.h"
+
+//check n features of dimension d, values should be within [-1, 1]
+static bool validFeatures(const float *p, size_t n, int d) {
+	for (size_t i = 0; i < n * d; i ++) {
+		if (p[i] > 1.0 || p[i] < -1.0) {
+			return false;
+		}
+	}
+	return true;
+}
 
 Status FaissServiceImpl::HSet(ServerContext* context, 
 		const ::faiss_server::HSetRequest* request, 
 		::faiss_server::HSetResponse* response) {
-	std::ostringstream oss;
-	oss << "request_id:" << request->request_id()
+	AccessRecord rec("HSet");
+	rec << "request_id:" << request->request_id()
 		<< " cmd:HSet"
 		<< " db_name:" << request->db_name();
 
 	response->set_request_id(request->request_id());
 	
-	std::string feaStr = request->feature();
+	//read in place, no copy of the request feature
+	const std::string &feaStr = request->feature();
 	if (feaStr.length() < 1) {
 		response->set_error_code(INVALID_ARGUMENT);	
 		response->set_error_msg("INVALID_ARGUMENT: feature");
-		oss << " error_code:" << response->error_code()
+		rec << " error_code:" << response->error_code()
+			<< " error_msg:" << response->error_msg();
+		rec.commit(true);	
+		return Status::OK;
+	}
+	if (request->tags_size() > MaxTags) {
+		response->set_error_code(INVALID_ARGUMENT);	
+		response->set_error_msg("INVALID_ARGUMENT: too many tags");
+		rec << " tags:" << request->tags_size()
+			<< " error_code:" << response->error_code()
+			<< " error_msg:" << response->error_msg();
+		rec.commit(true);
+		return Status::OK;
+	}
+	Deadline deadline(context);
+	AdmissionTicket ticket(admission.get(), WorkInsert, &deadline);
+	if (ticket.rc() != 0) {
+		response->set_error_code(ticket.rc());
+		response->set_error_msg(Admission::errorMsg(ticket.rc()));
+		rec << " error_code:" << response->error_code()
 			<< " error_msg:" << response->error_msg();
-		LOG(WARNING) << oss.str();	
+		rec.commit(true);
 		return Status::OK;
 	}
 	
@@ -30,9 +61,9 @@ Status FaissServiceImpl::HSet(ServerContext* context,
 	if (it == dbs.end()) {
 		response->set_error_code(NOT_FOUND);	
 		response->set_error_msg("DB NOT FOUND");
-		oss << " error_code:" << response->error_code()
+		rec << " error_code:" << response->error_code()
 			<< " error_msg:" << response->error_msg();
-		LOG(WARNING) << oss.str();	
+		rec.commit(true);	
 		return Status::OK;
 	}
 
@@ -44,59 +75,294 @@ Status FaissServiceImpl::HSet(ServerContext* context,
 	if (feaLen != d) {
 		response->set_error_code(DIMENSION_NOT_EQUAL);	
 		response->set_error_msg("request feature dimension is not equal to database");	
-		oss << " error_code:" << response->error_code()
+		rec << " error_code:" << response->error_code()
 			<< " error_msg:" << response->error_msg();
-		LOG(WARNING) << oss.str();
+		rec.commit(true);
 		return Status::OK;
 	}
 
 	long id = 0;
-	float *p = (float*)feaStr.data();
+	std::vector<float> buf;
+	const float *p = floatView(feaStr, &buf);
 	//check data content
-	bool isValid = true;
-	for (int i = 0; i < d; i ++) {
-		if (p[i] > 1.0 || p[i] < -1.0) {
-			isValid = false;
-			break;
-		}
-	}
-	if (!isValid) {
+	if (!validFeatures(p, 1, d)) {
 		response->set_error_code(INVALID_ARGUMENT);	
 		response->set_error_msg("request feature is invalid");	
-		oss << " error_code:" << response->error_code()
+		rec << " error_code:" << response->error_code()
 			<< " error_msg:" << response->error_msg();
-		LOG(WARNING) << oss.str();
+		rec.commit(true);
 		return Status::OK;
 	}
-	int rc = db->addFeature((float*)feaStr.data(), d, &id);
+	int rc = 0;
+	if (db->groupWriter != NULL) {
+		//acked after the commit of its group
+		rc = db->groupWriter->add(p, d, request->tags().data(), request->tags_size(), &id);
+	} else {
+		rc = db->addFeature(p, d, request->tags().data(), request->tags_size(), &id);
+	}
 	if (rc != 0) {
 		response->set_error_code(rc);	
 		response->set_error_msg("add feature failed");	
-		oss << " error_code:" << response->error_code()
+		rec << " error_code:" << response->error_code()
 			<< " error_msg:" << response->error_msg();
-		LOG(WARNING) << oss.str();
+		rec.commit(true);
 		return Status::OK;
 	}
 	response->set_error_code(OK);	
 	response->set_id(id);
-	oss << " new_fea_id:" << id
+	rec << " new_fea_id:" << id
+		<< " tags:" << request->tags_size()
 		<< " ntotal:" << index->ntotal  
 		<< " error_code:" << response->error_code();
-	LOG(INFO) << oss.str();
+	rec.commit();
 	return Status::OK; 
 }
 
+Status FaissServiceImpl::HSetBatch(ServerContext* context,
+		const ::faiss_server::HSetBatchRequest* request,
+		::faiss_server::HSetBatchResponse* response) {
+	AccessRecord rec("HSetBatch");
+	rec << "request_id:" << request->request_id()
+		<< " cmd:HSetBatch"
+		<< " db_name:" << request->db_name()
+		<< " tags_per_feature:" << request->tags_per_feature();
+
+	response->set_request_id(request->request_id());
+
+	const std::string &feaStr = request->features();
+	size_t ntags = request->tags_per_feature();
+	if (feaStr.length() < 1 || ntags > (size_t)MaxTags) {
+		response->set_error_code(INVALID_ARGUMENT);
+		response->set_error_msg("INVALID_ARGUMENT: features");
+		rec << " error_code:" << response->error_code()
+			<< " error_msg:" << response->error_msg();
+		rec.commit(true);
+		return Status::OK;
+	}
+	Deadline deadline(context);
+	AdmissionTicket ticket(admission.get(), WorkInsert, &deadline);
+	if (ticket.rc() != 0) {
+		response->set_error_code(ticket.rc());
+		response->set_error_msg(Admission::errorMsg(ticket.rc()));
+		rec << " error_code:" << response->error_code()
+			<< " error_msg:" << response->error_msg();
+		rec.commit(true);
+		return Status::OK;
+	}
+
+	unique_readguard<WfirstRWLock> readlock(*m_lock);
+	std::map<std::string, FaissDB*>::iterator it = dbs.find(request->db_name());
+	if (it == dbs.end()) {
+		response->set_error_code(NOT_FOUND);
+		response->set_error_msg("DB NOT FOUND");
+		rec << " error_code:" << response->error_code()
+			<< " error_msg:" << response->error_msg();
+		rec.commit(true);
+		return Status::OK;
+	}
+	FaissDB *db = it->second;
+	auto index = db->index;
+	int d = index->d;
+	size_t n = feaStr.length() / (sizeof(float) * d);
+	rec << " db_dim:" << d
+		<< " n:" << n;
+	if (feaStr.length() % (sizeof(float) * d) != 0) {
+		response->set_error_code(DIMENSION_NOT_EQUAL);
+		response->set_error_msg("request features length is not a multiple of database dimension");
+		rec << " error_code:" << response->error_code()
+			<< " error_msg:" << response->error_msg();
+		rec.commit(true);
+		return Status::OK;
+	}
+	if (n > (size_t)globalConfig.MaxSetBatch) {
+		response->set_error_code(INVALID_ARGUMENT);
+		response->set_error_msg("too many features in one batch");
+		rec << " error_code:" << response->error_code()
+			<< " error_msg:" << response->error_msg();
+		rec.commit(true);
+		return Status::OK;
+	}
+	if ((size_t)request->tags_size() != n * ntags) {
+		response->set_error_code(INVALID_ARGUMENT);
+		response->set_error_msg("tags size is not n * tags_per_feature");
+		rec << " error_code:" << response->error_code()
+			<< " error_msg:" << response->error_msg();
+		rec.commit(true);
+		return Status::OK;
+	}
+	std::vector<float> buf;
+	const float *p = floatView(feaStr, &buf);
+	if (!validFeatures(p, n, d)) {
+		response->set_error_code(INVALID_ARGUMENT);
+		response->set_error_msg("request feature is invalid");
+		rec << " error_code:" << response->error_code()
+			<< " error_msg:" << response->error_msg();
+		rec.commit(true);
+		return Status::OK;
+	}
+	long firstID = 0;
+	int rc = db->addFeatures(p, n, ntags > 0 ? request->tags().data() : NULL, ntags, &firstID);
+	if (rc != 0) {
+		response->set_error_code(rc);
+		response->set_error_msg("add features failed");
+		rec << " error_code:" << response->error_code()
+			<< " error_msg:" << response->error_msg();
+		rec.commit(true);
+		return Status::OK;
+	}
+	response->set_error_code(OK);
+	response->set_first_id(firstID);
+	response->set_count(n);
+	rec << " first_id:" << firstID
+		<< " ntotal:" << index->ntotal
+		<< " error_code:" << response->error_code();
+	rec.commit();
+	return Status::OK;
+}
+
+Status FaissServiceImpl::HSetStream(ServerContext* context,
+		ServerReader< ::faiss_server::HSetRequest>* reader,
+		::faiss_server::HSetStreamResponse* response) {
+	AccessRecord rec("HSetStream");
+	rec << "cmd:HSetStream"
+		<< " peer:" << context->peer();
+
+	//features are written in batches of MaxSetBatch, the dbs lock is
+	//only held while writing a batch, so DbNew and DbDel are not blocked
+	//by a long stream
+	Deadline deadline(context);
+	size_t maxBatch = std::max(1, globalConfig.MaxSetBatch);
+	std::string dbName;
+	size_t featureBytes = 0;
+	std::vector<float> features;
+	//MaxTags per feature, unset tags are 0
+	std::vector<int32_t> tags;
+	size_t ntags = 0;
+	size_t pending = 0;
+	size_t count = 0;
+	int rc = 0;
+	const char *errMsg = "";
+
+	auto flush = [&]() -> int {
+		AdmissionTicket ticket(admission.get(), WorkInsert, &deadline);
+		if (ticket.rc() != 0) {
+			errMsg = Admission::errorMsg(ticket.rc());
+			return ticket.rc();
+		}
+		unique_readguard<WfirstRWLock> readlock(*m_lock);
+		std::map<std::string, FaissDB*>::iterator it = dbs.find(dbName);
+		if (it == dbs.end()) {
+			errMsg = "DB NOT FOUND";
+			return NOT_FOUND;
+		}
+		FaissDB *db = it->second;
+		if (featureBytes != sizeof(float) * db->index->d) {
+			errMsg = "request feature dimension is not equal to database";
+			return DIMENSION_NOT_EQUAL;
+		}
+		//only the columns used by the batch are stored
+		for (size_t i = 0; ntags < (size_t)MaxTags && i < pending; i ++) {
+			std::copy(tags.begin() + i * MaxTags, tags.begin() + i * MaxTags + ntags,
+					tags.begin() + i * ntags);
+		}
+		long firstID = 0;
+		int res = db->addFeatures(features.data(), pending, ntags > 0 ? tags.data() : NULL, ntags, &firstID);
+		if (res != 0) {
+			errMsg = "add features failed";
+			return res;
+		}
+		auto range = response->add_ranges();
+		range->set_first_id(firstID);
+		range->set_count(pending);
+		count += pending;
+		pending = 0;
+		ntags = 0;
+		features.clear();
+		tags.clear();
+		return 0;
+	};
+
+	::faiss_server::HSetRequest request;
+	while (reader->Read(&request)) {
+		const std::string &feaStr = request.feature();
+		if (count + pending == 0) {
+			dbName = request.db_name();
+			featureBytes = feaStr.length();
+			response->set_request_id(request.request_id());
+			rec << " request_id:" << request.request_id()
+				<< " db_name:" << dbName;
+		}
+		if (request.db_name() != dbName) {
+			rc = INVALID_ARGUMENT;
+			errMsg = "all features of a stream should be of one db";
+			break;
+		}
+		if (feaStr.length() < 1 || feaStr.length() != featureBytes ||
+				feaStr.length() % sizeof(float) != 0 || request.tags_size() > MaxTags) {
+			rc = INVALID_ARGUMENT;
+			errMsg = "INVALID_ARGUMENT: feature";
+			break;
+		}
+		size_t d = featureBytes / sizeof(float);
+		size_t offset = features.size();
+		features.resize(offset + d);
+		memcpy(features.data() + offset, feaStr.data(), featureBytes);
+		if (!validFeatures(features.data() + offset, 1, d)) {
+			rc = INVALID_ARGUMENT;
+			errMsg = "request feature is invalid";
+			break;
+		}
+		tags.resize(tags.size() + MaxTags, 0);
+		std::copy(request.tags().begin(), request.tags().end(), tags.end() - MaxTags);
+		ntags = std::max(ntags, (size_t)request.tags_size());
+		pending ++;
+		if (pending >= maxBatch) {
+			rc = flush();
+			if (rc != 0) {
+				break;
+			}
+		}
+	}
+	if (0 == rc && pending > 0) {
+		rc = flush();
+	}
+	response->set_count(count);
+	response->set_error_code(rc);
+	if (rc != 0) {
+		response->set_error_msg(errMsg);
+	}
+	rec << " count:" << count
+		<< " batches:" << response->ranges_size()
+		<< " error_code:" << response->error_code();
+	if (rc != 0) {
+		rec << " error_msg:" << response->error_msg();
+	}
+	rec.commit(rc != 0);
+	return Status::OK;
+}
+
 //support idempotent delete
 Status FaissServiceImpl::HDel(ServerContext* context,
 		const ::faiss_server::HGetDelRequest* request,
 		::faiss_server::EmptyResponse* response) {
-	std::ostringstream oss;
-	oss << "request_id:" << request->request_id()
+	AccessRecord rec("HDel");
+	rec << "request_id:" << request->request_id()
 		<< " cmd:HDel"
 		<< " id:" << request->id()
 		<< " db_name:" << request->db_name();
 
 	std::string dbName = request->db_name();
+	Deadline deadline(context);
+	AdmissionTicket ticket(admission.get(), WorkInsert, &deadline);
+	if (ticket.rc() != 0) {
+		response->set_error_code(ticket.rc());
+		response->set_error_msg(Admission::errorMsg(ticket.rc()));
+		response->set_request_id(request->request_id());
+		rec << " error_code:" << response->error_code()
+			<< " error_msg:" << response->error_msg();
+		rec.commit(true);
+		return Status::OK;
+	}
 
 	unique_readguard<WfirstRWLock> readlock(*m_lock);
 	std::map<std::string, FaissDB*>::iterator it;
@@ -106,9 +372,9 @@ Status FaissServiceImpl::HDel(ServerContext* context,
 		response->set_error_code(grpc::StatusCode::NOT_FOUND);
 		response->set_error_msg("not found");
 		response->set_request_id(request->request_id());
-		oss << " error_code:" << response->error_code()
+		rec << " error_code:" << response->error_code()
 			<< " error_msg:" << response->error_msg();
-		LOG(WARNING) << oss.str();	
+		rec.commit(true);	
 		return Status::OK;
 	}
 
@@ -123,35 +389,46 @@ Status FaissServiceImpl::HDel(ServerContext* context,
 	//index->remove_ids(range);	
 
 	int rc = db->delFeature(id);
-	oss << " delete_rs:" << rc;
+	rec << " delete_rs:" << rc;
 	if (rc == grpc::StatusCode::ALREADY_EXISTS) {
 		//found
 		response->set_error_code(ALREADY_EXISTS);
 		response->set_error_msg("already deleted");
 		response->set_request_id(request->request_id());
-		oss << " error_code:" << response->error_code()
+		rec << " error_code:" << response->error_code()
 			<< " error_msg:" << response->error_msg();
-		LOG(WARNING) << oss.str();	
+		rec.commit(true);	
 		return Status::OK;
 	}
 	
 	response->set_error_code(rc);
 	response->set_request_id(request->request_id());
-	oss << " ntotal:" << index->ntotal
+	rec << " ntotal:" << index->ntotal
 		<< " error_code:" << response->error_code();
-	LOG(INFO) << oss.str();
+	rec.commit();
 	return Status::OK; 
 }
 Status FaissServiceImpl::HGet(ServerContext* context,
 		const ::faiss_server::HGetDelRequest* request,
 		::faiss_server::HGetResponse* response) {
-	std::ostringstream oss;
-	oss << "request_id:" << request->request_id()
+	AccessRecord rec("HGet");
+	rec << "request_id:" << request->request_id()
 		<< " cmd:HGet"
 		<< " id:" << request->id()
 		<< " db_name:" << request->db_name();
 	std::string dbName = request->db_name();
 	std::map<std::string, FaissDB*>::iterator it;
+	Deadline deadline(context);
+	AdmissionTicket ticket(admission.get(), WorkSearch, &deadline);
+	if (ticket.rc() != 0) {
+		response->set_error_code(ticket.rc());
+		response->set_error_msg(Admission::errorMsg(ticket.rc()));
+		response->set_request_id(request->request_id());
+		rec << " error_code:" << response->error_code()
+			<< " error_msg:" << response->error_msg();
+		rec.commit(true);
+		return Status::OK;
+	}
 	
 	unique_readguard<WfirstRWLock> readlock(*m_lock);
 	it = dbs.find(dbName);
@@ -160,9 +437,9 @@ Status FaissServiceImpl::HGet(ServerContext* context,
 		response->set_error_code(grpc::StatusCode::NOT_FOUND);
 		response->set_error_msg("NOT_FOUND");
 		response->set_request_id(request->request_id());
-		oss << " error_code:" << response->error_code()
+		rec << " error_code:" << response->error_code()
 			<< " error_msg:" << "db not found";
-		LOG(WARNING) << oss.str();	
+		rec.commit(true);	
 		return Status::OK;
 	}
 
@@ -175,17 +452,17 @@ Status FaissServiceImpl::HGet(ServerContext* context,
 		response->set_error_code(grpc::StatusCode::NOT_FOUND);
 		response->set_error_msg("NOT_FOUND");
 		response->set_request_id(request->request_id());
-		oss << " error_code:" << response->error_code()
+		rec << " error_code:" << response->error_code()
 			<< " error_msg:" << "feature not found";
-		LOG(WARNING) << oss.str();	
+		rec.commit(true);	
 		return Status::OK;
 	} else if (rc != 0) {
 		response->set_error_code(rc);
 		response->set_error_msg("internal error");
 		response->set_request_id(request->request_id());
-		oss << " error_code:" << response->error_code()
+		rec << " error_code:" << response->error_code()
 			<< " error_msg:" << response->error_msg();
-		LOG(WARNING) << oss.str();
+		rec.commit(true);
 		return Status::OK;
 	}
 
@@ -194,8 +471,8 @@ Status FaissServiceImpl::HGet(ServerContext* context,
 	response->set_dimension(feaLen);
 
 	response->set_request_id(request->request_id());
-	oss << " dim:" << feaLen
+	rec << " dim:" << feaLen
 		<< " error_code:" << response->error_code();
-	LOG(INFO) << oss.str();
+	rec.commit();
 	return Status::OK;
 } 
@@ -0,0 +1,404 @@
+#include "faiss_index.h"
+#include <mutex>
+#include <algorithm>
+#include <omp.h>
+#include <glog/logging.h>
+#include "utils.h"
+#ifdef FAISS_SERVER_GPU
+#include "faiss/gpu/StandardGpuResources.h"
+#include "faiss/gpu/GpuIndexIVFPQ.h"
+#include "faiss/gpu/GpuAutoTune.h"
+#endif
+
+//limit the openmp threads of the calling thread in a scope
+class OmpThreadsGuard {
+	public:
+		explicit OmpThreadsGuard(int nt):saved(omp_get_max_threads()) {
+			omp_set_num_threads(nt);
+		}
+		~OmpThreadsGuard() {
+			omp_set_num_threads(saved);
+		}
+	private:
+		int saved;
+};
+
+//remove the ids skipped by params from the n result lists of size k,
+//the lists are padded with -1
+static void dropSkipped(faiss::Index::idx_t n, faiss::Index::idx_t k, const ScanParams &params,
+		float *dis, faiss::Index::idx_t *nns) {
+	if ((NULL == params.deleted || params.deleted->size() < 1) && NULL == params.filter) {
+		return;
+	}
+	for (faiss::Index::idx_t i = 0; i < n; i ++) {
+		float *d = dis + i * k;
+		faiss::Index::idx_t *l = nns + i * k;
+		faiss::Index::idx_t j = 0;
+		for (faiss::Index::idx_t m = 0; m < k; m ++) {
+			if (l[m] >= 0 && !params.skip(l[m])) {
+				d[j] = d[m];
+				l[j] = l[m];
+				j ++;
+			}
+		}
+		for (; j < k; j ++) {
+			l[j] = -1;
+		}
+	}
+}
+
+class CpuIndexBackend: public IndexBackend {
+	public:
+		CpuIndexBackend():index(NULL),nprobe(1) {}
+		~CpuIndexBackend() {
+			delete index;
+			index = NULL;
+		}
+
+		int load(faiss::IndexIVFPQ *cpuIndex) override {
+			if (NULL == cpuIndex) {
+				return -1;
+			}
+			delete index;
+			index = cpuIndex;
+			//index->nprobe is the width of the coarse assignment passed to
+			//search_preassigned, the probes of a search are at most this
+			index->nprobe = std::min(index->nlist,
+					(size_t)std::max(globalConfig.MaxNProbes, globalConfig.NProbes));
+			return 0;
+		}
+
+		faiss::Index *getIndex() override {
+			return index;
+		}
+
+		//the index is only read by searches, concurrent searches need no lock.
+		//a single query is searched by the calling thread only, so that
+		//concurrent requests do not oversubscribe the openmp pool.
+		void search(faiss::Index::idx_t n, const float *x, faiss::Index::idx_t k,
+				const ScanParams &params, float *dis, faiss::Index::idx_t *nns) override {
+			ScanParams scan = params;
+			scan.nprobe = std::max(1, scan.nprobe > 0 ? scan.nprobe : this->nprobe);
+			scan.nprobe = std::min(scan.nprobe, (int)index->nprobe);
+			if (n > 1) {
+				searchScan(n, x, k, scan, dis, nns);
+				return;
+			}
+			OmpThreadsGuard guard(1);
+			searchScan(n, x, k, scan, dis, nns);
+		}
+
+		int rangeSearch(faiss::Index::idx_t n, const float *x, float radius,
+				size_t maxResults, const ScanParams &params, faiss::RangeSearchResult *res,
+				bool *truncated) override {
+			if (!ivfpqScannable(index)) {
+				return -1;
+			}
+			ScanParams scan = params;
+			scan.nprobe = std::max(1, scan.nprobe > 0 ? scan.nprobe : this->nprobe);
+			scan.nprobe = std::min(scan.nprobe, (int)index->nprobe);
+			if (n > 1) {
+				ivfpqRangeSearch(index, n, x, radius, maxResults, scan, res, truncated);
+				return 0;
+			}
+			OmpThreadsGuard guard(1);
+			ivfpqRangeSearch(index, n, x, radius, maxResults, scan, res, truncated);
+			return 0;
+		}
+
+		void add(faiss::Index::idx_t n, const float *x, const long *ids) override {
+			index->add_with_ids(n, x, ids);
+		}
+
+		void setNumProbes(int nprobe) override {
+			this->nprobe = nprobe;
+		}
+
+		int numLists() override {
+			return index->nlist;
+		}
+
+		//the cpu heaps have no limit, the request limits bound k
+		faiss::Index::idx_t maxK() override {
+			return (faiss::Index::idx_t)globalConfig.MaxTopK * MaxRefineFactor;
+		}
+
+		//the serving index is already a cpu index, write it as is
+		void write(const std::string &path) override {
+			faiss::write_index(index, path.c_str());
+		}
+
+		void status(std::ostringstream &oss) override {
+			int numList = index->nlist;
+			oss << " num_list:" << numList;
+			for (int i = 0; i < numList; i ++) {
+				auto &ids = index->ids[i];
+				if (ids.size() < 1) {
+					continue;
+				}
+				oss << " 	list_id:" << i << " list_len:" << ids.size() << " list_idx:";
+				for (size_t j = 0; j < ids.size(); j ++) {
+					oss << ids[j] << ",";
+				}
+				oss << " list_codes:";
+				auto &codes = index->codes[i];
+				for (size_t j = 0; j < codes.size(); j ++) {
+					oss << uint32_t(codes[j]) << ",";
+				}
+			}
+		}
+
+		const std::string &device() override {
+			return SDeviceCPU;
+		}
+
+	private:
+		//deleted and filtered ids are skipped while scanning the lists, so that
+		//k live results are found. indexes with codes other than 8 bits fall back
+		//to search_preassigned and drop the skipped ids afterwards
+		void searchScan(faiss::Index::idx_t n, const float *x, faiss::Index::idx_t k,
+				const ScanParams &scan, float *dis, faiss::Index::idx_t *nns) {
+			if (ivfpqScannable(index)) {
+				ivfpqSearch(index, n, x, k, scan, dis, nns);
+				return;
+			}
+			searchProbes(n, x, k, scan.nprobe, dis, nns);
+			dropSkipped(n, k, scan, dis, nns);
+		}
+
+		//assign the queries to their nprobe nearest lists, the rest of
+		//the index->nprobe slots are -1 and skipped by search_preassigned,
+		//so that the probes are per search and the index is not changed
+		void searchProbes(faiss::Index::idx_t n, const float *x, faiss::Index::idx_t k,
+				int nprobe, float *dis, faiss::Index::idx_t *nns) {
+			size_t width = index->nprobe;
+			size_t probes = nprobe;
+
+			std::vector<faiss::Index::idx_t> assign(n * width, -1);
+			std::vector<float> coarseDis(n * width, 0);
+			if (probes == width) {
+				index->quantizer->search(n, x, probes, coarseDis.data(), assign.data());
+			} else {
+				std::vector<faiss::Index::idx_t> keys(n * probes);
+				std::vector<float> keyDis(n * probes);
+				index->quantizer->search(n, x, probes, keyDis.data(), keys.data());
+				for (faiss::Index::idx_t i = 0; i < n; i ++) {
+					std::copy(keys.begin() + i * probes, keys.begin() + (i + 1) * probes,
+							assign.begin() + i * width);
+					std::copy(keyDis.begin() + i * probes, keyDis.begin() + (i + 1) * probes,
+							coarseDis.begin() + i * width);
+				}
+			}
+			index->search_preassigned(n, x, k, assign.data(), coarseDis.data(),
+					dis, nns, false);
+		}
+
+		faiss::IndexIVFPQ *index;
+
+		//default probes of searches
+		int nprobe;
+};
+
+#ifdef FAISS_SERVER_GPU
+//StandardGpuResources is not thread safe, all calls to gpu indexes
+//of all dbs are serialized by gpuMutex
+static std::mutex gpuMutex;
+
+//max k of a gpu search
+static const faiss::Index::idx_t GpuMaxK = 1024;
+
+//all gpu dbs share one StandardGpuResources on device 0
+static faiss::gpu::StandardGpuResources *gpuResources() {
+	static std::once_flag flag;
+	static faiss::gpu::StandardGpuResources *resources = NULL;
+	std::call_once(flag, []() {
+		cudaSetDevice(0);
+		resources = new faiss::gpu::StandardGpuResources;
+	});
+	return resources;
+}
+
+class GpuIndexBackend: public IndexBackend {
+	public:
+		GpuIndexBackend():index(NULL),nprobe(1) {}
+		~GpuIndexBackend() {
+			delete index;
+			index = NULL;
+		}
+
+		int load(faiss::IndexIVFPQ *cpuIndex) override {
+			if (NULL == cpuIndex) {
+				return -1;
+			}
+			faiss::gpu::GpuIndexIVFPQConfig config;
+			config.device = 0;
+			faiss::gpu::GpuIndexIVFPQ *gpuIndex = NULL;
+			std::lock_guard<std::mutex> guard(gpuMutex);
+			try {
+				gpuIndex = new faiss::gpu::GpuIndexIVFPQ(gpuResources(), cpuIndex, config);
+			} catch(...) {
+				delete cpuIndex;
+				throw;
+			}
+			//data is on the gpu now
+			delete cpuIndex;
+			delete index;
+			index = gpuIndex;
+			return 0;
+		}
+
+		faiss::Index *getIndex() override {
+			return index;
+		}
+
+		//the gpu index takes nprobe from its state only, searches are
+		//serialized by gpuMutex anyway, so a per search nprobe is set
+		//and restored within the same critical section.
+		//the gpu scan can not skip ids, deleted ids are over-fetched
+		//(up to the gpu k limit) and dropped afterwards. filtered searches
+		//fetch the gpu k limit and keep the accepted ids
+		void search(faiss::Index::idx_t n, const float *x, faiss::Index::idx_t k,
+				const ScanParams &params, float *dis, faiss::Index::idx_t *nns) override {
+			int probes = params.nprobe > 0 ? params.nprobe : this->nprobe;
+			probes = std::min(probes, std::max(globalConfig.MaxNProbes, globalConfig.NProbes));
+			faiss::Index::idx_t fetch = k;
+			if (params.deleted != NULL && params.deleted->size() > 0) {
+				fetch = std::max(k, std::min(k + (faiss::Index::idx_t)params.deleted->size(),
+							GpuMaxK));
+			}
+			if (params.filter != NULL) {
+				fetch = std::max(k, GpuMaxK);
+			}
+			std::vector<float> fetchDis;
+			std::vector<faiss::Index::idx_t> fetchNns;
+			float *d = dis;
+			faiss::Index::idx_t *l = nns;
+			if (fetch > k) {
+				fetchDis.resize(n * fetch);
+				fetchNns.resize(n * fetch);
+				d = fetchDis.data();
+				l = fetchNns.data();
+			}
+			{
+				std::lock_guard<std::mutex> guard(gpuMutex);
+				probes = std::max(1, std::min(probes, index->getNumLists()));
+				if (probes == this->nprobe) {
+					index->search(n, x, fetch, d, l);
+				} else {
+					index->setNumProbes(probes);
+					try {
+						index->search(n, x, fetch, d, l);
+					} catch(...) {
+						index->setNumProbes(this->nprobe);
+						throw;
+					}
+					index->setNumProbes(this->nprobe);
+				}
+			}
+			dropSkipped(n, fetch, params, d, l);
+			if (fetch == k) {
+				return;
+			}
+			for (faiss::Index::idx_t i = 0; i < n; i ++) {
+				std::copy(d + i * fetch, d + i * fetch + k, dis + i * k);
+				std::copy(l + i * fetch, l + i * fetch + k, nns + i * k);
+			}
+		}
+
+		//GpuIndexIVFPQ has no range search
+		int rangeSearch(faiss::Index::idx_t n, const float *x, float radius,
+				size_t maxResults, const ScanParams &params, faiss::RangeSearchResult *res,
+				bool *truncated) override {
+			return -1;
+		}
+
+		void add(faiss::Index::idx_t n, const float *x, const long *ids) override {
+			std::lock_guard<std::mutex> guard(gpuMutex);
+			index->add_with_ids(n, x, ids);
+		}
+
+		void setNumProbes(int nprobe) override {
+			std::lock_guard<std::mutex> guard(gpuMutex);
+			nprobe = std::max(1, std::min(nprobe, index->getNumLists()));
+			index->setNumProbes(nprobe);
+			this->nprobe = nprobe;
+		}
+
+		int numLists() override {
+			std::lock_guard<std::mutex> guard(gpuMutex);
+			return index->getNumLists();
+		}
+
+		//gpu k selection fails beyond
+		faiss::Index::idx_t maxK() override {
+			return GpuMaxK;
+		}
+
+		void write(const std::string &path) override {
+			faiss::Index *cpu_index = NULL;
+			{
+				std::lock_guard<std::mutex> guard(gpuMutex);
+				cpu_index = faiss::gpu::index_gpu_to_cpu(index);
+			}
+			faiss::write_index(cpu_index, path.c_str());
+			delete cpu_index;
+		}
+
+		void status(std::ostringstream &oss) override {
+			std::lock_guard<std::mutex> guard(gpuMutex);
+			int numList = index->getNumLists();
+			oss << " num_list:" << numList;
+			for (int i = 0; i < numList; i ++) {
+				int len = index->getListLength(i);
+				if (len < 1) {
+					continue;
+				}
+				oss << " 	list_id:" << i << " list_len:" << len << " list_idx:";
+				auto idx = index->getListIndices(i);
+				for (size_t j = 0; j < idx.size(); j ++) {
+					oss << idx[j] << ",";
+				}
+				oss << " list_codes:";
+				auto codes = index->getListCodes(i);
+				for (size_t j = 0; j < codes.size(); j ++) {
+					oss << uint32_t(codes[j]) << ",";
+				}
+			}
+		}
+
+		const std::string &device() override {
+			return SDeviceGPU;
+		}
+
+	private:
+		faiss::gpu::GpuIndexIVFPQ *index;
+
+		//default probes of searches, guarded by gpuMutex
+		int nprobe;
+};
+#endif
+
+bool validDevice(const std::string &device) {
+	if (device == SDeviceCPU) {
+		return true;
+	}
+#ifdef FAISS_SERVER_GPU
+	if (device == SDeviceGPU) {
+		return true;
+	}
+#endif
+	return false;
+}
+
+IndexBackend *newIndexBackend(const std::string &device) {
+	if (device == SDeviceCPU) {
+		return new CpuIndexBackend;
+	}
+#ifdef FAISS_SERVER_GPU
+	if (device == SDeviceGPU) {
+		return new GpuIndexBackend;
+	}
+#endif
+	LOG(WARNING) << "index device not supported:" << device;
+	return NULL;
+}
@@ -1,52 +1,741 @@
 #include <stdlib.h>
 #include <stdio.h>
+#include <deque>
+#include <set>
+#include <memory>
+#include <condition_variable>
 #include <grpc++/grpc++.h>
 #include "faiss_logic.h"
 #include "core_db.h"
-struct Node {
-	::google::protobuf::uint64 id;
-  	float score;
-};
+#include "access_log.h"
+#include "deadline.h"
+#include "search_result.h"
+#include "faiss/Heap.h"
 struct {
 	bool operator() (Node node1,Node node2) {
 		return node1.score > node2.score;
 	}
 } SortFunc;
+
+struct {
+	bool operator() (Node node1,Node node2) {
+		return node1.score < node2.score;
+	}
+} AscSortFunc;
+
+//nodes re-scored between two deadline checks
+static const size_t RescoreChunk = 256;
+
+//replace the index distances of nodes by exact distances computed
+//from the raw features in lmdb, and sort nodes by them.
+//L2 dbs drop nodes beyond thresh afterwards.
+static int refineNodes(FaissDB *db, const float *query, float thresh, const Deadline *deadline,
+		std::vector<Node> *nodes) {
+	size_t n = nodes->size();
+	std::vector<long> ids(n);
+	std::vector<float> dis(n);
+	std::vector<int> rcs(n);
+	for (size_t i = 0; i < n; i++) {
+		ids[i] = (*nodes)[i].id;
+	}
+	for (size_t i = 0; i < n; i += RescoreChunk) {
+		if (deadline != NULL && deadline->expired()) {
+			return DEADLINE_EXCEEDED;
+		}
+		size_t m = std::min(RescoreChunk, n - i);
+		int rc = db->refineDistances(query, ids.data() + i, m, dis.data() + i, rcs.data() + i);
+		if (rc != 0) {
+			return rc;
+		}
+	}
+	nodes->clear();
+	for (size_t i = 0; i < n; i++) {
+		if (rcs[i] == MDB_NOTFOUND) {
+			continue;
+		} else if (rcs[i] != 0) {
+			return rcs[i];
+		}
+		Node node;
+		node.score = dis[i];
+		node.id = ids[i];
+		nodes->push_back(node);
+	}
+	if (db->index->metric_type == faiss::METRIC_INNER_PRODUCT) {
+		std::sort(nodes->begin(), nodes->end(), SortFunc);
+		return 0;
+	}
+	std::sort(nodes->begin(), nodes->end(), AscSortFunc);
+	if (db->metric == faiss_server::DbNewRequest::L2) {
+		size_t i = 0;
+		while (i < nodes->size() && (*nodes)[i].score <= thresh) {
+			i ++;
+		}
+		nodes->resize(i);
+	}
+	return 0;
+}
+
+//re-rank nodes by cosine distance, keep at most topk nodes.
+//their features are read in one lmdb transaction per RescoreChunk nodes
+static int rerankCosine(FaissDB *db, const float *query, size_t topk, const Deadline *deadline,
+		std::vector<Node> *nodes) {
+	size_t n = nodes->size();
+	std::vector<long> ids(n);
+	std::vector<float> scores(n);
+	std::vector<int> rcs(n);
+	for (size_t i = 0; i < n; i++) {
+		ids[i] = (*nodes)[i].id;
+	}
+	for (size_t i = 0; i < n; i += RescoreChunk) {
+		if (deadline != NULL && deadline->expired()) {
+			return DEADLINE_EXCEEDED;
+		}
+		size_t m = std::min(RescoreChunk, n - i);
+		int rc = db->calcCosines(query, ids.data() + i, m, scores.data() + i, rcs.data() + i);
+		if (rc != 0) {
+			return rc;
+		}
+	}
+	nodes->clear();
+	for (size_t i = 0; i < n; i++) {
+		if (rcs[i] == MDB_NOTFOUND) {
+			continue;
+		} else if (rcs[i] != 0) {
+			return rcs[i];
+		}
+		Node node;
+		node.score = scores[i];
+		node.id = ids[i];
+		nodes->push_back(node);
+	}
+	//sort cosine distance
+	std::sort(nodes->begin(), nodes->end(), SortFunc);
+	if (nodes->size() > topk) {
+		nodes->resize(topk);
+	}
+	return 0;
+}
+
+//filter the raw ann results of one query by thresh, refine them by exact distances if refine is set, and re-rank them by
+//cosine scores if needed. keep at most topk nodes.
+//InnerProduct and Cosine dbs score by their own metric,
+//they need neither the threshold nor the cosine re-rank.
+//deleted ids are already skipped by the index scan.
+//return DEADLINE_EXCEEDED if deadline expires before a lmdb stage or between the
+//chunks of a stage, deadline may be NULL.
+//should call with a readlock of dbs
+static int collectNodes(FaissDB *db, const float *query, int disType,
+		size_t topk, bool refine, float thresh, int searchTopK, const faiss::Index::idx_t *nns,
+		const float *dis, const Deadline *deadline, std::vector<Node> *nodes) {
+	bool isL2 = db->metric == faiss_server::DbNewRequest::L2;
+	bool isCosine = isL2 && disType == faiss_server::HSearchRequest::Cosine;
+	//all candidates are re-scored by refine or cosine re-rank,
+	//approximate distances are not checked when refined
+	bool keepAll = refine || isCosine;
+	appendCandidates(nns, dis, searchTopK, topk, keepAll, !refine && isL2, thresh, nodes);
+	if (nodes->size() < 1) {
+		return 0;
+	}
+	if (refine) {
+		int rc = refineNodes(db, query, thresh, deadline, nodes);
+		if (rc != 0) {
+			return rc;
+		}
+	}
+	if (isCosine) {
+		return rerankCosine(db, query, topk, deadline, nodes);
+	}
+	if (nodes->size() > topk) {
+		nodes->resize(topk);
+	}
+	for (auto it = nodes->begin(); it != nodes->end(); ++it) {
+		it->score = db->toScore(it->score);
+	}
+	return 0;
+}
+
+//top_k of a search request, 3 by default and at most MaxTopK
+static size_t requestTopK(::google::protobuf::uint64 reqTopK) {
+	if (reqTopK < 1) {
+		return 3;
+	}
+	return std::min(reqTopK, (::google::protobuf::uint64)globalConfig.MaxTopK);
+}
+
+//L2 distance threshold of a search request, 0 for EuclidThresh
+static float requestThresh(float reqThresh) {
+	return reqThresh > 0 ? reqThresh : globalConfig.EuclidThresh;
+}
+
+//per query options of a search request
+struct SearchOptions {
+	size_t topk;
+	float thresh;
+	int disType;
+	//request values, 0 for the db defaults
+	int nprobe;
+	int refineFactor;
+	//tag filters, empty for none
+	std::vector<TagFilter> filters;
+	//deadline of the rpc, NULL never expires
+	const Deadline *deadline;
+	//return the results scanned so far instead of DEADLINE_EXCEEDED
+	bool bestEffort;
+	//wait until the ids up to minID are searchable, 0 for no wait
+	long minID;
+
+	SearchOptions():topk(3),thresh(0),disType(0),nprobe(0),refineFactor(0),
+		deadline(NULL),bestEffort(false),minID(0) {}
+};
+
+//convert the tag filters of a request, return false if a tag is out of range
+static bool parseFilters(const ::google::protobuf::RepeatedPtrField< ::faiss_server::TagFilter> &reqFilters,
+		std::vector<TagFilter> *filters) {
+	filters->resize(reqFilters.size());
+	for (int i = 0; i < reqFilters.size(); i ++) {
+		const ::faiss_server::TagFilter &rf = reqFilters.Get(i);
+		if (rf.tag() >= (::google::protobuf::uint32)MaxTags) {
+			return false;
+		}
+		TagFilter &f = (*filters)[i];
+		f.tag = rf.tag();
+		f.values.assign(rf.values().begin(), rf.values().end());
+		std::sort(f.values.begin(), f.values.end());
+		f.minValue = rf.min_value();
+		f.maxValue = rf.max_value();
+	}
+	return true;
+}
+
+//true if the scores of db are distances, ranked ascending
+static bool ascendingScores(FaissDB *db, int disType) {
+	return db->metric == faiss_server::DbNewRequest::L2 &&
+		disType == faiss_server::HSearchRequest::Euclid;
+}
+
+//result cache key of a search: the query bytes and every option changing its results
+static void cacheKey(const std::string &feaStr, const SearchOptions &opts,
+		int nprobe, int factor, std::string *key) {
+	key->assign(feaStr);
+	auto append = [key](const void *p, size_t len) {
+		key->append((const char*)p, len);
+	};
+	uint64_t topk = opts.topk;
+	append(&topk, sizeof(topk));
+	append(&opts.thresh, sizeof(opts.thresh));
+	append(&opts.disType, sizeof(opts.disType));
+	append(&nprobe, sizeof(nprobe));
+	append(&factor, sizeof(factor));
+	for (size_t i = 0; i < opts.filters.size(); i ++) {
+		const TagFilter &f = opts.filters[i];
+		uint32_t nvalues = f.values.size();
+		append(&f.tag, sizeof(f.tag));
+		append(&nvalues, sizeof(nvalues));
+		append(f.values.data(), nvalues * sizeof(int32_t));
+		append(&f.minValue, sizeof(f.minValue));
+		append(&f.maxValue, sizeof(f.maxValue));
+	}
+}
+
+//number of index candidates of topk results. deleted ids are skipped by
+//the scan, only refine and cosine re-rank need more candidates than topk.
+//at most the k limit of the backend
+static int searchCandidates(FaissDB *db, size_t topk, int factor, bool rerank) {
+	size_t candidates = factor > 0 ? topk * factor : (rerank ? topk * 2 : topk);
+	return (int)std::min(candidates, (size_t)db->backend->maxK());
+}
+
+//search one query in db into nodes ranked by score, at most opts.topk nodes.
+//complete results are cached in the db result cache if it has one.
+//return 0 on success, else an error code and errMsg.
+//when opts.deadline expires during the scan, best effort searches return
+//the lists scanned so far without refine and set partial, others DEADLINE_EXCEEDED.
+//should call with a readlock of dbs
+static int searchDb(FaissDB *db, const std::string &feaStr, const SearchOptions &opts,
+		std::vector<Node> *nodes, bool *partial, const char **errMsg) {
+	auto index = db->index;
+	//request values override the db defaults
+	int nprobe = opts.nprobe;
+	int factor = opts.refineFactor;
+	db->searchParams(&nprobe, &factor);
+	factor = std::min(factor, MaxRefineFactor);
+	bool rerank = db->metric == faiss_server::DbNewRequest::L2 &&
+		opts.disType == faiss_server::HSearchRequest::Cosine;
+	int candidates = searchCandidates(db, opts.topk, factor, rerank);
+
+	int feaLen = feaStr.length() / sizeof(float);
+	if (feaLen != index->d) {
+		*errMsg = "request feature dimension is not equal to database";
+		return DIMENSION_NOT_EQUAL;
+	}
+	//read your writes of the async ingestion
+	if (opts.minID > 0 && db->waitIngested(opts.minID, opts.deadline) != 0) {
+		*errMsg = "ingestion behind min_id";
+		return DEADLINE_EXCEEDED;
+	}
+	if (index->ntotal < 1) {
+		*errMsg = "database is empty";
+		return NOT_FOUND;
+	}
+	if (opts.deadline != NULL && opts.deadline->expired()) {
+		*errMsg = "deadline exceeded";
+		return DEADLINE_EXCEEDED;
+	}
+	//the epoch is read before the search, a write during the
+	//search makes the cached results stale at once
+	uint64_t epoch = db->writeEpoch.load(std::memory_order_acquire);
+	if (db->cache != NULL) {
+		cacheKey(feaStr, opts, nprobe, factor, &searchScratch.cacheKey);
+		if (db->cache->get(searchScratch.cacheKey, epoch, &searchScratch.cached)) {
+			for (size_t i = 0; i < searchScratch.cached.size(); i ++) {
+				Node node;
+				node.id = searchScratch.cached[i].id;
+				node.score = searchScratch.cached[i].score;
+				nodes->push_back(node);
+			}
+			return 0;
+		}
+	}
+	VLOG(50) << "Searching the "<< candidates << " nearest neighbors in the index";
+
+	std::vector<faiss::Index::idx_t> &nns = searchScratch.nns;
+	std::vector<float>               &dis = searchScratch.dis;
+	nns.resize(candidates);
+	dis.resize(candidates);
+
+	const float *query = db->prepareQueries(feaStr, 1, &searchScratch.queries);
+	int rc = 0;
+	if (opts.filters.size() > 0) {
+		//filtered queries do not share a batch
+		db->searchDirect(query, candidates, nprobe, &opts.filters, opts.deadline, dis.data(), nns.data());
+	} else {
+		rc = db->searchOne(query, candidates, nprobe, opts.deadline, dis.data(), nns.data());
+	}
+	if (rc != 0) {
+		*errMsg = "search index failed";
+		return INTERNAL;
+	}
+	const Deadline *deadline = opts.deadline;
+	bool refine = factor > 0;
+	if (deadline != NULL && deadline->expired()) {
+		if (!opts.bestEffort) {
+			*errMsg = "deadline exceeded";
+			return DEADLINE_EXCEEDED;
+		}
+		//index distances are not refined, but cosine scores
+		//still need the re-rank to rank like the other results
+		*partial = true;
+		deadline = NULL;
+		refine = false;
+	}
+	rc = collectNodes(db, query, opts.disType, opts.topk, refine, opts.thresh, candidates, nns.data(), dis.data(), deadline, nodes);
+	if (rc == DEADLINE_EXCEEDED) {
+		*errMsg = "deadline exceeded";
+		return rc;
+	} else if (rc != 0) {
+		*errMsg = "calculate distance failed";
+		return rc;
+	}
+	if (db->cache != NULL && !*partial) {
+		searchScratch.cached.resize(nodes->size());
+		for (size_t i = 0; i < nodes->size(); i ++) {
+			searchScratch.cached[i].id = (*nodes)[i].id;
+			searchScratch.cached[i].score = (*nodes)[i].score;
+		}
+		db->cache->put(searchScratch.cacheKey, epoch, searchScratch.cached);
+	}
+	return 0;
+}
+
 Status FaissServiceImpl::HSearch(ServerContext* context,
 		const ::faiss_server::HSearchRequest* request, 
 		::faiss_server::HSearchResponse* response) {
-	std::ostringstream oss;
-	oss << "request_id:" << request->request_id()
+	Deadline deadline(context);
+	return SearchOne(request, response, &deadline);
+}
+
+Status FaissServiceImpl::SearchOne(const ::faiss_server::HSearchRequest* request,
+		::faiss_server::HSearchResponse* response, const Deadline *deadline) {
+	AccessRecord rec("HSearch");
+	rec << "request_id:" << request->request_id()
 		<< " cmd:HSearch"
 		<< " db_name:" << request->db_name()
 		<< " top_k:" << request->top_k()
+		<< " refine_factor:" << request->refine_factor()
+		<< " nprobe:" << request->nprobe()
+		<< " threshold:" << request->threshold()
+		<< " filters:" << request->filters_size()
+		<< " best_effort:" << request->best_effort()
+		<< " min_id:" << request->min_id()
 		<< " dist_type:" << request->distance_type();
 	
 	response->set_request_id(request->request_id());
 	
-	size_t topk = request->top_k();
-	if (topk < 1) {
-		topk = 3;
-	} else if (topk > 5) {
-		topk = 5;
-	}
-
-	int respCount = 0;
-	std::vector<Node> cosineNodes;
-	int searchTopK = topk * 2;
-	std::string feaStr = request->feature();
-	if (feaStr.length() < 1 || topk > 10) {
+	SearchOptions opts;
+	opts.topk = requestTopK(request->top_k());
+	opts.thresh = requestThresh(request->threshold());
+	opts.nprobe = request->nprobe();
+	opts.refineFactor = request->refine_factor();
+	opts.deadline = deadline;
+	opts.bestEffort = request->best_effort();
+	opts.minID = request->min_id();
+
+	std::vector<Node> &nodes = searchScratch.nodes;
+	nodes.clear();
+	const std::string &feaStr = request->feature();
+	if (feaStr.length() < 1) {
 		response->set_error_code(INVALID_ARGUMENT);	
 		response->set_error_msg("invalid argument");
-		oss << " error_code:" << response->error_code()
+		rec << " error_code:" << response->error_code()
+			<< " error_msg:" << response->error_msg();
+		rec.commit(true);
+		return Status::OK;
+	}
+	if (!parseFilters(request->filters(), &opts.filters)) {
+		response->set_error_code(INVALID_ARGUMENT);	
+		response->set_error_msg("invalid tag filter");
+		rec << " error_code:" << response->error_code()
+			<< " error_msg:" << response->error_msg();
+		rec.commit(true);
+		return Status::OK;
+	}
+	opts.disType = faiss_server::HSearchRequest::Euclid;
+	if (request->distance_type() == faiss_server::HSearchRequest::Cosine) {
+		opts.disType = faiss_server::HSearchRequest::Cosine;
+	}
+	//nobody waits for the answer, do not queue on the lock
+	if (deadline != NULL && deadline->expired()) {
+		response->set_error_code(DEADLINE_EXCEEDED);
+		response->set_error_msg("deadline exceeded");
+		rec << " error_code:" << response->error_code()
 			<< " error_msg:" << response->error_msg();
-		LOG(WARNING) << oss.str();
+		rec.commit(true);
+		return Status::OK;
+	}
+	AdmissionTicket ticket(admission.get(), WorkSearch, deadline);
+	if (ticket.rc() != 0) {
+		response->set_error_code(ticket.rc());
+		response->set_error_msg(Admission::errorMsg(ticket.rc()));
+		rec << " error_code:" << response->error_code()
+			<< " error_msg:" << response->error_msg();
+		rec.commit(true);
+		return Status::OK;
+	}
+	bool partial = false;
+	{
+		unique_readguard<WfirstRWLock> readlock(*m_lock);
+		std::string dbName = request->db_name();
+		std::map<std::string, FaissDB*>::iterator it;
+		it = dbs.find(dbName);
+		if (it == dbs.end()) {
+			response->set_error_code(grpc::StatusCode::NOT_FOUND);
+			response->set_error_msg("dbname not found");
+			rec << " error_code:" << response->error_code()
+				<< " error_msg:" << response->error_msg();
+			rec.commit(true);
+			return Status::OK;
+		}
+		FaissDB *db = it->second;
+		rec << " db_dim:" << db->index->d
+			<< " req_dim:" << feaStr.length() / sizeof(float);
+		const char *errMsg = "";
+		int rc = searchDb(db, feaStr, opts, &nodes, &partial, &errMsg);
+		if (rc != 0) {
+			response->set_error_code(rc);
+			response->set_error_msg(errMsg);
+			rec << " error_code:" << response->error_code()
+				<< " error_msg:" << response->error_msg();
+			rec.commit(true);
+			return Status::OK;
+		}
+	}
+	if (nodes.size() < 1) {
+		response->set_error_code(NOT_FOUND);
+		response->set_error_msg("search no result");
+		rec << " error_code:" << response->error_code()
+			<< " error_msg:" << response->error_msg();
+		rec.commit(true);
+		return Status::OK;
+	}
+	if (rec.sampled()) {
+		for (auto it = nodes.begin(); it != nodes.end(); ++it) {
+			rec << " " << it->id << ":" << it->score;
+		}
+	}
+	fillResults(nodes, response->mutable_results());
+	response->set_partial(partial);
+	response->set_error_code(OK);
+	rec << " partial:" << partial
+		<< " error_code:0";
+	rec.commit();
+
+	return Status::OK;
+}
+
+//hits of one db of HSearchMulti
+struct DbHits {
+	FaissDB *db;
+	int rc;
+	const char *errMsg;
+	bool partial;
+	std::vector<Node> nodes;
+	DbHits():db(NULL),rc(0),errMsg(""),partial(false) {}
+};
+
+//k-way merge of the ranked node lists of the dbs into the topk best,
+//with a heap of the list heads like faiss::heap_addn. Heap ids are list numbers
+static void mergeHits(const std::vector<DbHits> &hits, bool ascending, size_t topk,
+		std::vector<std::pair<size_t, Node> > *merged) {
+	size_t nl = hits.size();
+	std::vector<float> heapScores(nl);
+	std::vector<long> heapLists(nl);
+	std::vector<size_t> heads(nl, 0);
+	size_t k = 0;
+	for (size_t i = 0; i < nl; i ++) {
+		if (hits[i].nodes.size() < 1) {
+			continue;
+		}
+		k ++;
+		if (ascending) {
+			faiss::minheap_push(k, heapScores.data(), heapLists.data(), hits[i].nodes[0].score, (long)i);
+		} else {
+			faiss::maxheap_push(k, heapScores.data(), heapLists.data(), hits[i].nodes[0].score, (long)i);
+		}
+	}
+	while (k > 0 && merged->size() < topk) {
+		size_t i = heapLists[0];
+		merged->push_back(std::make_pair(i, hits[i].nodes[heads[i]]));
+		if (ascending) {
+			faiss::minheap_pop(k, heapScores.data(), heapLists.data());
+		} else {
+			faiss::maxheap_pop(k, heapScores.data(), heapLists.data());
+		}
+		k --;
+		heads[i] ++;
+		if (heads[i] >= hits[i].nodes.size()) {
+			continue;
+		}
+		k ++;
+		if (ascending) {
+			faiss::minheap_push(k, heapScores.data(), heapLists.data(), hits[i].nodes[heads[i]].score, (long)i);
+		} else {
+			faiss::maxheap_push(k, heapScores.data(), heapLists.data(), hits[i].nodes[heads[i]].score, (long)i);
+		}
+	}
+}
+
+Status FaissServiceImpl::HSearchMulti(ServerContext* context,
+		const ::faiss_server::HSearchMultiRequest* request,
+		::faiss_server::HSearchMultiResponse* response) {
+	AccessRecord rec("HSearchMulti");
+	rec << "request_id:" << request->request_id()
+		<< " cmd:HSearchMulti"
+		<< " db_count:" << request->db_names_size()
+		<< " top_k:" << request->top_k()
+		<< " refine_factor:" << request->refine_factor()
+		<< " nprobe:" << request->nprobe()
+		<< " threshold:" << request->threshold()
+		<< " filters:" << request->filters_size()
+		<< " dist_type:" << request->distance_type();
+
+	response->set_request_id(request->request_id());
+
+	SearchOptions opts;
+	opts.topk = requestTopK(request->top_k());
+	opts.thresh = requestThresh(request->threshold());
+	opts.nprobe = request->nprobe();
+	opts.refineFactor = request->refine_factor();
+	Deadline deadline(context);
+	opts.deadline = &deadline;
+	opts.bestEffort = request->best_effort();
+	opts.disType = faiss_server::HSearchRequest::Euclid;
+	if (request->distance_type() == faiss_server::HSearchRequest::Cosine) {
+		opts.disType = faiss_server::HSearchRequest::Cosine;
+	}
+
+	const std::string &feaStr = request->feature();
+	if (feaStr.length() < 1 || request->db_names_size() < 1) {
+		response->set_error_code(INVALID_ARGUMENT);
+		response->set_error_msg("invalid argument");
+		rec << " error_code:" << response->error_code()
+			<< " error_msg:" << response->error_msg();
+		rec.commit(true);
+		return Status::OK;
+	}
+	if (request->db_names_size() > globalConfig.MaxFanoutDbs) {
+		response->set_error_code(INVALID_ARGUMENT);
+		response->set_error_msg("too many dbs in one request");
+		rec << " error_code:" << response->error_code()
+			<< " error_msg:" << response->error_msg();
+		rec.commit(true);
+		return Status::OK;
+	}
+	if (!parseFilters(request->filters(), &opts.filters)) {
+		response->set_error_code(INVALID_ARGUMENT);
+		response->set_error_msg("invalid tag filter");
+		rec << " error_code:" << response->error_code()
+			<< " error_msg:" << response->error_msg();
+		rec.commit(true);
+		return Status::OK;
+	}
+
+	AdmissionTicket ticket(admission.get(), WorkSearch, &deadline);
+	if (ticket.rc() != 0) {
+		response->set_error_code(ticket.rc());
+		response->set_error_msg(Admission::errorMsg(ticket.rc()));
+		rec << " error_code:" << response->error_code()
+			<< " error_msg:" << response->error_msg();
+		rec.commit(true);
+		return Status::OK;
+	}
+
+	//a db named twice is searched once
+	std::vector<std::string> names;
+	std::set<std::string> seen;
+	for (int i = 0; i < request->db_names_size(); i ++) {
+		if (seen.insert(request->db_names(i)).second) {
+			names.push_back(request->db_names(i));
+		}
+	}
+	std::vector<DbHits> hits(names.size());
+	bool ascending = true;
+	{
+		unique_readguard<WfirstRWLock> readlock(*m_lock);
+		int found = 0;
+		for (size_t i = 0; i < names.size(); i ++) {
+			std::map<std::string, FaissDB*>::iterator it = dbs.find(names[i]);
+			if (it == dbs.end()) {
+				hits[i].rc = NOT_FOUND;
+				hits[i].errMsg = "dbname not found";
+				continue;
+			}
+			//scores of all dbs must rank the same way to be merged
+			bool asc = ascendingScores(it->second, opts.disType);
+			if (found > 0 && asc != ascending) {
+				response->set_error_code(INVALID_ARGUMENT);
+				response->set_error_msg("dbs with distance and similarity scores can not be merged");
+				rec << " error_code:" << response->error_code()
+					<< " error_msg:" << response->error_msg();
+				rec.commit(true);
+				return Status::OK;
+			}
+			ascending = asc;
+			hits[i].db = it->second;
+			found ++;
+		}
+
+		//the dbs are searched by the fanout pool, or by this thread when
+		//the pool queue is full. the readlock of dbs is held until all finish
+		std::mutex mutex;
+		std::condition_variable condDone;
+		int pending = 0;
+		for (size_t i = 0; i < hits.size(); i ++) {
+			if (NULL == hits[i].db) {
+				continue;
+			}
+			DbHits *h = &hits[i];
+			auto task = [&, h]() {
+				h->rc = searchDb(h->db, feaStr, opts, &h->nodes, &h->partial, &h->errMsg);
+				std::lock_guard<std::mutex> guard(mutex);
+				if (-- pending == 0) {
+					condDone.notify_one();
+				}
+			};
+			{
+				std::lock_guard<std::mutex> guard(mutex);
+				pending ++;
+			}
+			if (!fanoutPool->trySubmit(task)) {
+				task();
+			}
+		}
+		std::unique_lock<std::mutex> ulk(mutex);
+		condDone.wait(ulk, [&]()->bool {return pending == 0; });
+	}
+
+	std::vector<std::pair<size_t, Node> > merged;
+	mergeHits(hits, ascending, opts.topk, &merged);
+	bool partial = false;
+	for (size_t i = 0; i < hits.size(); i ++) {
+		partial = partial || hits[i].partial;
+		if (hits[i].rc == 0 && hits[i].nodes.size() > 0) {
+			continue;
+		}
+		auto e = response->add_db_errors();
+		e->set_db_name(names[i]);
+		e->set_error_code(hits[i].rc != 0 ? hits[i].rc : NOT_FOUND);
+		e->set_error_msg(hits[i].rc != 0 ? hits[i].errMsg : "search no result");
+		rec << " " << names[i] << ":" << e->error_code();
+	}
+	if (merged.size() < 1) {
+		response->set_error_code(NOT_FOUND);
+		response->set_error_msg("search no result");
+		rec << " error_code:" << response->error_code()
+			<< " error_msg:" << response->error_msg();
+		rec.commit(true);
+		return Status::OK;
+	}
+	response->mutable_results()->Reserve(merged.size());
+	for (size_t i = 0; i < merged.size(); i ++) {
+		const Node &node = merged[i].second;
+		if (rec.sampled()) {
+			rec << " " << names[merged[i].first] << "/" << node.id << ":" << node.score;
+		}
+		auto rs = response->add_results();
+		rs->set_score(node.score);
+		rs->set_id(node.id);
+		rs->set_db_name(names[merged[i].first]);
+	}
+	response->set_partial(partial);
+	response->set_error_code(OK);
+	rec << " partial:" << partial
+		<< " error_code:0";
+	rec.commit();
+	return Status::OK;
+}
+
+Status FaissServiceImpl::HSearchBatch(ServerContext* context,
+		const ::faiss_server::HSearchBatchRequest* request, 
+		::faiss_server::HSearchBatchResponse* response) {
+	AccessRecord rec("HSearchBatch");
+	rec << "request_id:" << request->request_id()
+		<< " cmd:HSearchBatch"
+		<< " db_name:" << request->db_name()
+		<< " top_k:" << request->top_k()
+		<< " refine_factor:" << request->refine_factor()
+		<< " nprobe:" << request->nprobe()
+		<< " threshold:" << request->threshold()
+		<< " dist_type:" << request->distance_type();
+	
+	response->set_request_id(request->request_id());
+	
+	size_t topk = requestTopK(request->top_k());
+	float thresh = requestThresh(request->threshold());
+
+	const std::string &feaStr = request->features();
+	if (feaStr.length() < 1) {
+		response->set_error_code(INVALID_ARGUMENT);	
+		response->set_error_msg("invalid argument");
+		rec << " error_code:" << response->error_code()
+			<< " error_msg:" << response->error_msg();
+		rec.commit(true);
 		return Status::OK;
 	}
 	int disType = faiss_server::HSearchRequest::Euclid;
 	if (request->distance_type() == faiss_server::HSearchRequest::Cosine) {
 		disType = faiss_server::HSearchRequest::Cosine;
 	}
+	Deadline deadline(context);
+	AdmissionTicket ticket(admission.get(), WorkBulkSearch, &deadline);
+	if (ticket.rc() != 0) {
+		response->set_error_code(ticket.rc());
+		response->set_error_msg(Admission::errorMsg(ticket.rc()));
+		rec << " error_code:" << response->error_code()
+			<< " error_msg:" << response->error_msg();
+		rec.commit(true);
+		return Status::OK;
+	}
+	size_t hits = 0;
 	{
 		unique_readguard<WfirstRWLock> readlock(*m_lock);
 		std::string dbName = request->db_name();
@@ -55,101 +744,311 @@ Status FaissServiceImpl::HSearch(ServerContext* context,
 		if (it == dbs.end()) {
 			response->set_error_code(grpc::StatusCode::NOT_FOUND);
 			response->set_error_msg("dbname not found");
-			oss << " error_code:" << response->error_code()
+			rec << " error_code:" << response->error_code()
 				<< " error_msg:" << response->error_msg();
-			LOG(WARNING) << oss.str();
+			rec.commit(true);
 			return Status::OK;
 		}
 		FaissDB *db = it->second;
 		auto index = db->index;
+		//request values override the db defaults
+		int nprobe = request->nprobe();
+		int factor = request->refine_factor();
+		db->searchParams(&nprobe, &factor);
+		factor = std::min(factor, MaxRefineFactor);
+		bool rerank = db->metric == faiss_server::DbNewRequest::L2 &&
+			disType == faiss_server::HSearchRequest::Cosine;
+		int candidates = searchCandidates(db, topk, factor, rerank);
 
-		int feaLen = feaStr.length() / sizeof(float);
 		int d = index->d;
-		oss << " db_dim:" << d
-			<< " req_dim:" << feaLen;
-		if (feaLen != d) {
+		size_t nq = feaStr.length() / (sizeof(float) * d);
+		rec << " db_dim:" << d
+			<< " nq:" << nq;
+		if (feaStr.length() % (sizeof(float) * d) != 0) {
 			response->set_error_code(DIMENSION_NOT_EQUAL);	
-			response->set_error_msg("request feature dimension is not equal to database");	
-			oss << " error_code:" << response->error_code()
+			response->set_error_msg("request features length is not a multiple of database dimension");	
+			rec << " error_code:" << response->error_code()
+				<< " error_msg:" << response->error_msg();
+			rec.commit(true);
+			return Status::OK;
+		}
+		if (nq > (size_t)globalConfig.MaxBatchQueries) {
+			response->set_error_code(INVALID_ARGUMENT);	
+			response->set_error_msg("too many queries in one batch");	
+			rec << " error_code:" << response->error_code()
 				<< " error_msg:" << response->error_msg();
-			LOG(WARNING) << oss.str();
+			rec.commit(true);
+			return Status::OK;
+		}
+		//the candidates of all queries are held at once
+		if (nq * candidates > (size_t)globalConfig.MaxBatchCandidates) {
+			response->set_error_code(INVALID_ARGUMENT);	
+			response->set_error_msg("too many candidates in one batch, lower top_k, refine_factor or the queries");	
+			rec << " candidates:" << candidates
+				<< " error_code:" << response->error_code()
+				<< " error_msg:" << response->error_msg();
+			rec.commit(true);
 			return Status::OK;
 		}
 		if (index->ntotal < 1) {
 			response->set_error_code(NOT_FOUND);	
 			response->set_error_msg("database is empty");	
-			oss << " error_code:" << response->error_code()
+			rec << " error_code:" << response->error_code()
 				<< " error_msg:" << response->error_msg();
-			LOG(WARNING) << oss.str();
+			rec.commit(true);
 			return Status::OK;
 		}
-		VLOG(50) << "Searching the "<< searchTopK << " nearest neighbors in the index";
+		VLOG(50) << "Searching the "<< candidates << " nearest neighbors of " << nq << " queries in the index";
 
-		std::vector<faiss::Index::idx_t> nns(searchTopK);
-		std::vector<float>               dis(searchTopK);
+		const float *queries = db->prepareQueries(feaStr, nq, &searchScratch.queries);
+		std::vector<faiss::Index::idx_t> &nns = searchScratch.nns;
+		std::vector<float>               &dis = searchScratch.dis;
+		nns.resize(nq * candidates);
+		dis.resize(nq * candidates);
 
-		//write lock
-		{
-			unique_writeguard<WfirstRWLock> writelock(*(db->lock));
-			index->search (1, (float*)feaStr.data(), searchTopK, dis.data(), nns.data());
-		}
-		for (int j = 0; j < searchTopK && respCount < topk; j++) {
-			if (db->inBlackList(nns[j])) {
-				continue;
-			}	
-			if (dis[j] > globalConfig.EuclidThresh) {
-				break;
-			}
-			float dist = dis[j];
-		
-			if (disType == faiss_server::HSearchRequest::Cosine) {
-				//compute cosine distance
-				int rc = db->calcCosine((float*)feaStr.data(), nns[j], &dist);
-				if (rc == MDB_NOTFOUND) {
-					continue;
-				} else if (rc != 0) {
-					response->set_error_code(rc);
-					response->set_error_msg("calculate cosine distance failed");
-					oss << " error_code:" << response->error_code()
-						<< " error_msg:" << response->error_msg();
-					LOG(WARNING) << oss.str();
-					return Status::OK;
-				}
-				Node node;
-				node.score = dist;
-				node.id = nns[j];
-				cosineNodes.push_back(node);
-				respCount ++;
-			} else {
-				oss << " " << nns[j] << ":" << dist;
-				auto rs = response->add_results();
-				rs->set_score(dist);
-				rs->set_id(nns[j]);
-				respCount ++;
+		//one search call for all queries, faiss shares the coarse
+		//quantization and the list scanning setup among them
+		db->searchIndex(nq, queries, candidates, nprobe, &deadline, dis.data(), nns.data());
+		std::vector<Node> &nodes = searchScratch.nodes;
+		response->mutable_result_lists()->Reserve(nq);
+		for (size_t q = 0; q < nq; q++) {
+			nodes.clear();
+			int rc = deadline.expired() ? DEADLINE_EXCEEDED :
+				collectNodes(db, queries + q * d, disType, topk, factor > 0, thresh, candidates,
+					nns.data() + q * candidates, dis.data() + q * candidates, &deadline, &nodes);
+			if (rc != 0) {
+				response->clear_result_lists();
+				response->set_error_code(rc);
+				response->set_error_msg(rc == DEADLINE_EXCEEDED ? "deadline exceeded" : "calculate distance failed");
+				rec << " error_code:" << response->error_code()
+					<< " error_msg:" << response->error_msg();
+				rec.commit(true);
+				return Status::OK;
 			}
+			auto list = response->add_result_lists();
+			list->set_error_code(nodes.size() < 1 ? NOT_FOUND : OK);
+			fillResults(nodes, list->mutable_results());
+			hits += nodes.size();
 		}
+		searchScratch.shrink();
 	}
-	if (respCount < 1) {
-		response->set_error_code(NOT_FOUND);
-		response->set_error_msg("search no result");
-		oss << " error_code:" << response->error_code()
-			<< " error_msg:" << response->error_msg();
-		LOG(WARNING) << oss.str();
+	response->set_error_code(OK);
+	rec << " hits:" << hits
+		<< " error_code:0";
+	rec.commit();
+
+	return Status::OK;
+}
+
+Status FaissServiceImpl::HRangeSearch(ServerContext* context,
+		const ::faiss_server::HRangeSearchRequest* request,
+		ServerWriter< ::faiss_server::HRangeSearchResponse>* writer) {
+	AccessRecord rec("HRangeSearch");
+	rec << "request_id:" << request->request_id()
+		<< " cmd:HRangeSearch"
+		<< " db_name:" << request->db_name()
+		<< " radius:" << request->radius()
+		<< " max_results:" << request->max_results()
+		<< " nprobe:" << request->nprobe();
+
+	::faiss_server::HRangeSearchResponse response;
+	response.set_request_id(request->request_id());
+
+	size_t maxResults = globalConfig.MaxRangeResults;
+	if (request->max_results() > 0 && request->max_results() < maxResults) {
+		maxResults = request->max_results();
+	}
+	const std::string &feaStr = request->feature();
+	if (feaStr.length() < 1) {
+		response.set_error_code(INVALID_ARGUMENT);
+		response.set_error_msg("invalid argument");
+		rec << " error_code:" << response.error_code()
+			<< " error_msg:" << response.error_msg();
+		rec.commit(true);
+		writer->Write(response);
 		return Status::OK;
 	}
-	if (disType == faiss_server::HSearchRequest::Cosine) {
-		//sort cosine distance
-		std::sort(cosineNodes.begin(),cosineNodes.end(),SortFunc);
-		for (auto it = cosineNodes.begin(); it != cosineNodes.end(); ++it) {
-			oss << " " << it->id << ":" << it->score;
-			auto rs = response->add_results();
-			rs->set_score(it->score);
-			rs->set_id(it->id);
+	Deadline deadline(context);
+	AdmissionTicket ticket(admission.get(), WorkBulkSearch, &deadline);
+	if (ticket.rc() != 0) {
+		response.set_error_code(ticket.rc());
+		response.set_error_msg(Admission::errorMsg(ticket.rc()));
+		rec << " error_code:" << response.error_code()
+			<< " error_msg:" << response.error_msg();
+		rec.commit(true);
+		writer->Write(response);
+		return Status::OK;
+	}
+	std::vector<Node> nodes;
+	bool ascending = true;
+	bool truncated = false;
+	{
+		unique_readguard<WfirstRWLock> readlock(*m_lock);
+		std::string dbName = request->db_name();
+		std::map<std::string, FaissDB*>::iterator it;
+		it = dbs.find(dbName);
+		if (it == dbs.end()) {
+			response.set_error_code(grpc::StatusCode::NOT_FOUND);
+			response.set_error_msg("dbname not found");
+			rec << " error_code:" << response.error_code()
+				<< " error_msg:" << response.error_msg();
+			rec.commit(true);
+			writer->Write(response);
+			return Status::OK;
+		}
+		FaissDB *db = it->second;
+		auto index = db->index;
+		int feaLen = feaStr.length() / sizeof(float);
+		int d = index->d;
+		rec << " db_dim:" << d
+			<< " req_dim:" << feaLen;
+		if (feaLen != d) {
+			response.set_error_code(DIMENSION_NOT_EQUAL);
+			response.set_error_msg("request feature dimension is not equal to database");
+			rec << " error_code:" << response.error_code()
+				<< " error_msg:" << response.error_msg();
+			rec.commit(true);
+			writer->Write(response);
+			return Status::OK;
+		}
+		int nprobe = request->nprobe();
+		int factor = 0;
+		db->searchParams(&nprobe, &factor);
+
+		//radius is given as a score, L2 dbs keep the nearest first,
+		//InnerProduct and Cosine dbs the highest score first
+		ascending = db->index->metric_type == faiss::METRIC_L2 &&
+			db->metric == faiss_server::DbNewRequest::L2;
+		float radius = db->toDistance(request->radius());
+		const float *query = db->prepareQueries(feaStr, 1, &searchScratch.queries);
+		faiss::RangeSearchResult res(1);
+		int rc = deadline.expired() ? DEADLINE_EXCEEDED :
+			db->rangeSearch(query, radius, maxResults, nprobe, &deadline, &res, &truncated);
+		//a stopped scan misses results, nobody waits for them
+		if (0 == rc && deadline.expired()) {
+			rc = DEADLINE_EXCEEDED;
+		}
+		if (rc != 0) {
+			response.set_error_code(rc == DEADLINE_EXCEEDED ? DEADLINE_EXCEEDED : FAILED_PRECONDITION);
+			response.set_error_msg(rc == DEADLINE_EXCEEDED ? "deadline exceeded" :
+					"range search is not supported by the db index");
+			rec << " error_code:" << response.error_code()
+				<< " error_msg:" << response.error_msg();
+			rec.commit(true);
+			writer->Write(response);
+			return Status::OK;
+		}
+		nodes.resize(res.lims[1]);
+		for (size_t i = 0; i < res.lims[1]; i ++) {
+			nodes[i].id = res.labels[i];
+			nodes[i].score = db->toScore(res.distances[i]);
 		}
 	}
-	response->set_error_code(OK);
-	oss << " error_code:0";
-	LOG(INFO) << oss.str();
 
+	//stream the results without holding the locks
+	if (ascending) {
+		std::sort(nodes.begin(), nodes.end(), AscSortFunc);
+	} else {
+		std::sort(nodes.begin(), nodes.end(), SortFunc);
+	}
+	rec << " hits:" << nodes.size();
+	size_t chunk = std::max(1, globalConfig.RangeChunkSize);
+	size_t written = 0;
+	do {
+		response.clear_results();
+		size_t end = std::min(written + chunk, nodes.size());
+		for (size_t i = written; i < end; i ++) {
+			auto rs = response.add_results();
+			rs->set_score(nodes[i].score);
+			rs->set_id(nodes[i].id);
+		}
+		written = end;
+		response.set_error_code(nodes.size() > 0 ? OK : NOT_FOUND);
+		if (written == nodes.size()) {
+			response.set_truncated(truncated);
+		}
+		if (!writer->Write(response)) {
+			//client went away
+			rec << " written:" << written
+				<< " error_msg:write stream failed";
+			rec.commit(true);
+			return Status::CANCELLED;
+		}
+	} while (written < nodes.size());
+	rec << " truncated:" << truncated
+		<< " error_code:" << response.error_code();
+	rec.commit();
+	return Status::OK;
+}
+
+Status FaissServiceImpl::HSearchStream(ServerContext* context,
+		ServerReaderWriter< ::faiss_server::HSearchResponse, ::faiss_server::HSearchRequest>* stream) {
+	AccessRecord rec("HSearchStream");
+	rec << "cmd:HSearchStream"
+		<< " peer:" << context->peer();
+
+	//the handler thread reads queries, the shared stream pool searches them
+	//and writes the responses as soon as they are ready, so concurrent queries
+	//of the stream can also be batched by the db SearchBatcher. a query the
+	//pool queue has no room for is searched by the handler thread
+	std::mutex mutex;
+	std::condition_variable condDone;
+	size_t inflight = 0;
+	bool broken = false;
+	size_t maxInflight = std::max(1, globalConfig.StreamMaxInflight);
+
+	std::mutex writeMutex;
+	std::atomic<size_t> done(0);
+	//queries of the stream share its deadline
+	Deadline deadline(context);
+	auto search = [&](const ::faiss_server::HSearchRequest *request) {
+		::faiss_server::HSearchResponse response;
+		SearchOne(request, &response, &deadline);
+		bool ok = true;
+		{
+			//ServerReaderWriter::Write is not thread safe
+			std::lock_guard<std::mutex> guard(writeMutex);
+			ok = stream->Write(response);
+		}
+		done ++;
+		//notify under the lock, the handler returns once inflight is 0
+		std::lock_guard<std::mutex> guard(mutex);
+		broken = broken || !ok;
+		inflight --;
+		condDone.notify_all();
+	};
+
+	size_t received = 0;
+	while (true) {
+		//shared by the task, a std::function must be copyable
+		std::shared_ptr< ::faiss_server::HSearchRequest> request(new ::faiss_server::HSearchRequest);
+		if (!stream->Read(request.get())) {
+			break;
+		}
+		received ++;
+		{
+			std::unique_lock<std::mutex> ulk(mutex);
+			condDone.wait(ulk, [&]()->bool {return broken || inflight < maxInflight; });
+			if (broken) {
+				break;
+			}
+			inflight ++;
+		}
+		if (!streamPool->trySubmit([&, request]() { search(request.get()); })) {
+			search(request.get());
+		}
+	}
+	{
+		std::unique_lock<std::mutex> ulk(mutex);
+		condDone.wait(ulk, [&]()->bool {return inflight == 0; });
+	}
+	rec << " received:" << received
+		<< " answered:" << done.load()
+		<< " broken:" << broken;
+	if (broken) {
+		rec.commit(true);
+		return Status::CANCELLED;
+	}
+	rec.commit();
 	return Status::OK;
 }
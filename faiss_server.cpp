@@ -3,6 +3,7 @@
 #include <sys/time.h>
 #include <grpc++/grpc++.h>
 #include "faiss_logic.h"
+#include "access_log.h"
 
 double elapsed ()
 {
@@ -15,11 +16,15 @@ double elapsed ()
 Status FaissServiceImpl::DbNew(ServerContext* context,
 		const ::faiss_server::DbNewRequest* request, 
 		::faiss_server::EmptyResponse* response) {
-	std::ostringstream oss;
-	oss << "request_id:" << request->request_id()
+	AccessRecord rec("DbNew");
+	rec << "request_id:" << request->request_id()
 		<< " cmd:DbNew"
 		<< " max_size:" << request->max_size()
 		<< " model:" << request->model()
+		<< " device:" << globalConfig.Device
+		<< " metric:" << request->metric()
+		<< " refine_factor:" << request->refine_factor()
+		<< " target_recall:" << request->target_recall()
 		<< " db_name:" << request->db_name();
 	double t0 = elapsed();
 	int rc;
@@ -27,13 +32,16 @@ Status FaissServiceImpl::DbNew(ServerContext* context,
 	std::string model = request->model();
 	//校验参数
 	if (dbName.length() < 1 || dbName.length() > 50 ||
-			model.length() < 1 || model.length() > 100) {
+			model.length() < 1 || model.length() > 100 ||
+			!faiss_server::DbNewRequest::MetricType_IsValid(request->metric()) ||
+			request->refine_factor() > (::google::protobuf::uint32)MaxRefineFactor ||
+			request->target_recall() < 0 || request->target_recall() > 1) {
 		response->set_error_code(grpc::StatusCode::INVALID_ARGUMENT);
 		response->set_error_msg("INVALID_ARGUMENT");
 		response->set_request_id(request->request_id());
-		oss << " error_code:" << response->error_code()
+		rec << " error_code:" << response->error_code()
 			<< " error_msg:" << response->error_msg();
-		LOG(WARNING) << oss.str();	
+		rec.commit(true);
 		return grpc::Status::CANCELLED;
 	}
 	
@@ -42,15 +50,34 @@ Status FaissServiceImpl::DbNew(ServerContext* context,
 	if (request->max_size() > 1 && request->max_size() < MaxDBSize) {
 		maxSize = request->max_size();
 	}
-	oss << " new_max_size:" << maxSize;
+	rec << " new_max_size:" << maxSize;
 	//模型路径
-	std::string modelPath = "./model/" + request->model();
+	DbMeta meta;
+	meta.modelPath = "./model/" + request->model();
+	meta.maxSize = maxSize;
+	meta.device = globalConfig.Device;
+	meta.metric = request->metric();
+	meta.refineFactor = request->refine_factor();
+	meta.targetRecall = request->target_recall();
+	meta.durability = request->durability();
+	meta.writeMap = request->write_map();
+	meta.noReadahead = request->no_readahead();
 	size_t len = 128;
 	char key[len] ={'\0'};
-	char val[len] = {'\0'};
+	std::string val = meta.encode();
 
 	snprintf(key, len, "%s%s", SPrefix.c_str(), dbName.c_str());
-	snprintf(val, len, "%s%s%ld", modelPath.c_str(), SDivide.c_str(), maxSize);
+	Deadline deadline(context);
+	AdmissionTicket ticket(admission.get(), WorkAdmin, &deadline);
+	if (ticket.rc() != 0) {
+		response->set_error_code(ticket.rc());
+		response->set_error_msg(Admission::errorMsg(ticket.rc()));
+		response->set_request_id(request->request_id());
+		rec << " error_code:" << response->error_code()
+			<< " error_msg:" << response->error_msg();
+		rec.commit(true);
+		return Status::OK;
+	}
 	//检查dbs
 	{
 		unique_writeguard<WfirstRWLock> writelock(*m_lock);
@@ -61,46 +88,60 @@ Status FaissServiceImpl::DbNew(ServerContext* context,
 			response->set_error_code(grpc::StatusCode::ALREADY_EXISTS);
 			response->set_error_msg("ALREADY_EXISTS");
 			response->set_request_id(request->request_id());
-			oss << " error_code:" << response->error_code()
+			rec << " error_code:" << response->error_code()
 				<< " error_msg:" << response->error_msg();
-			LOG(WARNING) << oss.str();	
+			rec.commit(true);
 			return grpc::Status::OK;
 		}
 	
 		//加载index文件
-		FaissDB *db = new FaissDB(dbName, modelPath, maxSize, this->gpu_lock);
-		rc = db->loadIndex(m_resources, modelPath);
-		if (0 != rc) {
+		//the db and its threads, lmdb env and files go on every failure
+		std::unique_ptr<FaissDB> db(new FaissDB(dbName, meta));
+		rc = db->loadIndex(meta.modelPath);
+		if (INVALID_ARGUMENT == rc) {
+			response->set_error_code(grpc::StatusCode::INVALID_ARGUMENT);
+			response->set_error_msg("metric not supported by model");
+			response->set_request_id(request->request_id());
+			rec << " error_code:" << response->error_code()
+				<< " error_msg:" << response->error_msg();
+			rec.commit(true);
+			return Status::OK;
+		} else if (0 != rc) {
 			response->set_error_code(grpc::StatusCode::DATA_LOSS);
 			response->set_error_msg("load index failed");
 			response->set_request_id(request->request_id());
-			oss << " error_code:" << response->error_code()
+			rec << " error_code:" << response->error_code()
 				<< " error_msg:" << response->error_msg();
-			LOG(WARNING) << oss.str();	
+			rec.commit(true);
 			return Status::OK;
 		}
 
-		dbs[dbName] = db;
+		dbs[dbName] = db.release();
 	
 		//store kv format
-		//dbName:modelPath##maxSize
+		//dbName:modelPath##maxSize##device##metric##refineFactor##targetRecall
 		//dbName: 增加一个前缀后再入库
 		//modelPath: 初始化的模型文件 
 		//maxSize: 用于设置某个db的最大feature的大小
+		//device: index所在设备, cpu或gpu
+		//metric: L2, InnerProduct或Cosine
+		//refineFactor: 检索时精排的候选倍数, 0为不精排
+		//targetRecall: 自动调优的目标召回率, 0为不调优
+		//durability##writeMap##noReadahead: db lmdb的选项
 		
-		rc = lmdbSet(key, val);
+		rc = lmdbSet(key, (void*)val.data(), val.length());
 	}
 	response->set_error_code(rc);
 	response->set_request_id(request->request_id());
-	oss << " persist_info:(" << key << ":" << val <<") store resp " << rc
+	rec << " persist_info:(" << key << ":" << val <<") store resp " << rc
 		<< " error_code:" << response->error_code();
-	LOG(INFO) << oss.str();
+	rec.commit(rc != 0);
 	return Status::OK; 
 }
 //db list
 Status FaissServiceImpl::DbList(ServerContext* context, const ::faiss_server::DbListRequest* request, ::faiss_server::DbListResponse* response) {
-	std::ostringstream oss;
-	oss << "request_id:" << request->request_id()
+	AccessRecord rec("DbList");
+	rec << "request_id:" << request->request_id()
 		<< " cmd:DbList";
 
 	response->set_request_id(request->request_id());
@@ -114,31 +155,69 @@ Status FaissServiceImpl::DbList(ServerContext* context, const ::faiss_server::Db
 			auto status = response->add_db_status();
 			auto db = it->second; 
 			status->set_name(it->first);
-			status->set_ntotal((db->index)->ntotal);
-			status->set_max_size(db->maxSize);
-			status->set_curr_max_id(db->maxID);
-			status->set_curr_persist_max_id(db->maxPersistID);
-			status->set_persist_path(db->persistPath);
-			status->set_raw_data_path(db->lmdbPath);
-			status->set_dimension((db->index)->d);
-			std::string modelPath = db->modelPath;
-			size_t pos = modelPath.find_last_of("/");
-			if (pos != std::string::npos) {
-				status->set_model(modelPath.substr(pos + 1));
+			{
+				// ntotal/d 随 ingest、reload 变化, 需持有 db 读锁
+				unique_readguard<WfirstRWLock> dbLock(*(db->lock));
+				status->set_ntotal((db->index)->ntotal);
+				status->set_max_size(db->maxSize);
+				status->set_curr_max_id(db->maxID);
+				status->set_curr_persist_max_id(db->maxPersistID);
+				status->set_persist_path(db->persistPath);
+				status->set_raw_data_path(db->lmdbPath);
+				status->set_dimension((db->index)->d);
+				std::string modelPath = db->modelPath;
+				size_t pos = modelPath.find_last_of("/");
+				if (pos != std::string::npos) {
+					status->set_model(modelPath.substr(pos + 1));
+				}
+				status->set_black_list_len(db->blackListSize());
+				status->set_device(db->device);
+				status->set_metric(db->metric);
+				status->set_refine_factor(db->refineFactor);
+				status->set_target_recall(db->targetRecall);
+			}
+			// tunedPoint 自己取 db 读锁, 放在 dbLock 之外
+			TunedPoint point = db->tunedPoint();
+			status->set_tuned_nprobe(point.nprobe);
+			status->set_tuned_refine_factor(point.refineFactor);
+			status->set_tuned_recall(point.recall);
+			status->set_tuned_latency_ms(point.latencyMs);
+			if (db->cache != NULL) {
+				ResultCache::Stats stats = db->cache->stats();
+				status->set_cache_hits(stats.hits);
+				status->set_cache_misses(stats.misses);
+				status->set_cache_evictions(stats.evictions);
+				status->set_cache_bytes(stats.bytes);
+				status->set_cache_entries(stats.entries);
 			}
-			status->set_black_list_len((db->blackList).size());
 		}
 	}
-	oss << " db_len:" << count
+	if (admission) {
+		std::vector<Admission::ClassStats> stats;
+		admission->stats(&stats);
+		for (size_t i = 0; i < stats.size(); i ++) {
+			auto wc = response->add_work_classes();
+			wc->set_name(stats[i].name);
+			wc->set_running(stats[i].running);
+			wc->set_waiting(stats[i].waiting);
+			wc->set_admitted(stats[i].admitted);
+			wc->set_rejected(stats[i].rejected);
+			wc->set_expired(stats[i].expired);
+			wc->set_concurrency(stats[i].limits.concurrency);
+			wc->set_rate(stats[i].limits.rate);
+			wc->set_queue(stats[i].limits.queue);
+		}
+	}
+	rec << " db_len:" << count
 		<< " error_code:" << response->error_code();
-	LOG(INFO) << oss.str();
+	rec.commit();
 	return Status::OK;
 } 
 
 //db delete 
 Status FaissServiceImpl::DbDel(ServerContext* context, const ::faiss_server::DbDelRequest* request, ::faiss_server::EmptyResponse* response) { 
-	std::ostringstream oss;
-	oss << "request_id:" << request->request_id()
+	AccessRecord rec("DbDel");
+	rec << "request_id:" << request->request_id()
 		<< " cmd:DbDel"
 		<< " db_name:" << request->db_name();
 
@@ -148,11 +227,22 @@ Status FaissServiceImpl::DbDel(ServerContext* context, const ::faiss_server::DbD
 		response->set_error_code(grpc::StatusCode::INVALID_ARGUMENT);
 		response->set_error_msg("INVALID_ARGUMENT");
 		response->set_request_id(request->request_id());
-		oss << " error_code:" << response->error_code()
+		rec << " error_code:" << response->error_code()
 			<< " error_msg:" << response->error_msg();
-		LOG(WARNING) << oss.str();	
+		rec.commit(true);
 		return grpc::Status::CANCELLED;
 	}
+	Deadline deadline(context);
+	AdmissionTicket ticket(admission.get(), WorkAdmin, &deadline);
+	if (ticket.rc() != 0) {
+		response->set_error_code(ticket.rc());
+		response->set_error_msg(Admission::errorMsg(ticket.rc()));
+		response->set_request_id(request->request_id());
+		rec << " error_code:" << response->error_code()
+			<< " error_msg:" << response->error_msg();
+		rec.commit(true);
+		return Status::OK;
+	}
 
 	//检查dbs
 	{
@@ -161,7 +251,15 @@ Status FaissServiceImpl::DbDel(ServerContext* context, const ::faiss_server::DbD
 		it = dbs.find(dbName);
 		if (it != dbs.end()) {
 			auto db = it->second;
-			unique_writeguard<WfirstRWLock> writelock(*(db->lock));
+			//stop a running tuning of the db
+			db->dropped = true;
+			{
+				std::lock_guard<std::mutex> guard(db->tuneMutex);
+			}
+			{
+				//wait for running add/persist of the db, the lock is deleted with the db
+				unique_writeguard<WfirstRWLock> writelock(*(db->lock));
+			}
 			//db存在
 			//delete lmdb and index file
 			delete db;
@@ -173,9 +271,9 @@ Status FaissServiceImpl::DbDel(ServerContext* context, const ::faiss_server::DbD
 			int rc = lmdbDel(key.c_str());
 			response->set_error_code(grpc::StatusCode::OK);
 			response->set_request_id(request->request_id());
-			oss << " delete_res:" << rc
+			rec << " delete_res:" << rc
 				<< " error_code:" << response->error_code();
-			LOG(INFO) << oss.str();	
+			rec.commit();
 			return grpc::Status::OK;
 		}
 	}	
@@ -183,8 +281,8 @@ Status FaissServiceImpl::DbDel(ServerContext* context, const ::faiss_server::DbD
 	response->set_request_id(request->request_id());
 	response->set_error_code(grpc::StatusCode::NOT_FOUND);
 	response->set_error_msg("NOT_FOUND");
-	oss << " error_code:" << response->error_code()
+	rec << " error_code:" << response->error_code()
 		<< " error_msg:" << response->error_msg();
-	LOG(WARNING) << oss.str();	
+	rec.commit(true);
 	return Status::OK;
 } 
@@ -0,0 +1,85 @@
+#include "group_writer.h"
+#include <string.h>
+#include <algorithm>
+
+GroupWriter::GroupWriter(WriteFunc func, int maxGroup, int maxWaitUs):
+	func(func),maxGroup(std::max(1, maxGroup)),maxWaitUs(maxWaitUs),stopping(false) {
+	writer = std::thread(&GroupWriter::loop, this);
+}
+
+GroupWriter::~GroupWriter() {
+	{
+		std::lock_guard<std::mutex> guard(mutex);
+		stopping = true;
+	}
+	condQueue.notify_one();
+	writer.join();
+}
+
+int GroupWriter::add(const float *feature, int d, const int32_t *tags, size_t ntags, long *id) {
+	Pending p;
+	p.x = feature;
+	p.d = d;
+	p.tags = tags;
+	p.ntags = ntags;
+	p.id = 0;
+	p.rc = 0;
+	p.done = false;
+	std::unique_lock<std::mutex> ulk(mutex);
+	queue.push_back(&p);
+	if (queue.size() == 1 || queue.size() >= maxGroup) {
+		condQueue.notify_one();
+	}
+	condDone.wait(ulk, [&p]()->bool {return p.done; });
+	*id = p.id;
+	return p.rc;
+}
+
+int GroupWriter::write(const std::vector<Pending*> &group, long *firstID) {
+	size_t n = group.size();
+	int d = group[0]->d;
+	size_t ntags = 0;
+	for (size_t i = 0; i < n; i ++) {
+		ntags = std::max(ntags, group[i]->ntags);
+	}
+	features.resize(n * d);
+	//features of the group with fewer tags get 0, as unset tags
+	tags.assign(n * ntags, 0);
+	for (size_t i = 0; i < n; i ++) {
+		memcpy(features.data() + i * d, group[i]->x, sizeof(float) * d);
+		std::copy(group[i]->tags, group[i]->tags + group[i]->ntags, tags.begin() + i * ntags);
+	}
+	return func(features.data(), n, ntags > 0 ? tags.data() : NULL, ntags, firstID);
+}
+
+void GroupWriter::loop() {
+	std::vector<Pending*> group;
+	while (true) {
+		{
+			std::unique_lock<std::mutex> ulk(mutex);
+			condQueue.wait(ulk, [this]()->bool {return stopping || !queue.empty(); });
+			if (queue.empty()) {
+				return;
+			}
+			//let the group fill
+			if (queue.size() < maxGroup && maxWaitUs > 0 && !stopping) {
+				condQueue.wait_for(ulk, std::chrono::microseconds(maxWaitUs),
+						[this]()->bool {return stopping || queue.size() >= maxGroup; });
+			}
+			size_t n = std::min(queue.size(), maxGroup);
+			group.assign(queue.begin(), queue.begin() + n);
+			queue.erase(queue.begin(), queue.begin() + n);
+		}
+		long firstID = 0;
+		int rc = write(group, &firstID);
+		{
+			std::lock_guard<std::mutex> guard(mutex);
+			for (size_t i = 0; i < group.size(); i ++) {
+				group[i]->rc = rc;
+				group[i]->id = rc == 0 ? firstID + i : 0;
+				group[i]->done = true;
+			}
+		}
+		condDone.notify_all();
+	}
+}
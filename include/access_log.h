@@ -0,0 +1,87 @@
+#ifndef ACCESS_LOG_H
+#define ACCESS_LOG_H
+
+#include <string>
+#include <type_traits>
+
+//max bytes of one access log record, longer records are truncated
+const size_t AccessRecordSize = 1024;
+
+/**
+ * AccessLog writes the access records of the rpcs off the handler threads:
+ *		1) a handler formats its record into the fixed buffer of an AccessRecord
+ *		2) commit copies it into a slot of a lock free ring of --access_log_ring
+ *		   records, a full ring drops the record instead of waiting
+ *		3) one writer thread drains the ring into --access_log
+ *
+ * Records are sampled per cmd by --access_log_sample, error records are
+ * always kept. Without --access_log records go to glog as before.
+ */
+class AccessLog {
+	public:
+		//rates: "cmd=rate,..." sampling rates in [0, 1] per cmd, other cmds use defaultRate.
+		//path empty: log to glog. return 0 on success
+		static int init(const std::string &path, size_t ringSize, double defaultRate, const std::string &rates);
+
+		//flush the ring and stop the writer
+		static void stop();
+
+		//true if a record of cmd should be kept
+		static bool sample(const char *cmd);
+
+		//queue one record, never blocks
+		static void append(const char *data, size_t len, bool error);
+};
+
+//one access record, formatted like an ostringstream into a fixed buffer
+class AccessRecord {
+	public:
+		explicit AccessRecord(const char *cmd);
+
+		//false if the record will be dropped by sampling unless it is an error,
+		//so that handlers can skip formatting long details
+		bool sampled() const {
+			return keep;
+		}
+
+		AccessRecord &operator<<(const char *s);
+		AccessRecord &operator<<(const std::string &s);
+
+		template <class T>
+		typename std::enable_if<std::is_integral<T>::value || std::is_enum<T>::value, AccessRecord&>::type
+		operator<<(T v) {
+			if (std::is_signed<T>::value || std::is_enum<T>::value) {
+				appendSigned((long long)v);
+			} else {
+				appendUnsigned((unsigned long long)v);
+			}
+			return *this;
+		}
+
+		template <class T>
+		typename std::enable_if<std::is_floating_point<T>::value, AccessRecord&>::type
+		operator<<(T v) {
+			appendDouble(v);
+			return *this;
+		}
+
+		//the record as a string, for the glog fallback
+		std::string str() const {
+			return std::string(buf, len);
+		}
+
+		//log the record, error records are not sampled
+		void commit(bool error = false);
+
+	private:
+		void append(const char *s, size_t n);
+		void appendSigned(long long v);
+		void appendUnsigned(unsigned long long v);
+		void appendDouble(double v);
+
+		bool keep;
+		size_t len;
+		char buf[AccessRecordSize];
+};
+
+#endif
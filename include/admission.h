@@ -0,0 +1,122 @@
+#ifndef ADMISSION_H
+#define ADMISSION_H
+
+#include <mutex>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <stdint.h>
+#include <condition_variable>
+#include "deadline.h"
+
+//classes of work scheduled by Admission
+enum WorkClass {
+	WorkSearch = 0,	//interactive search: HSearch, HSearchMulti, HSearchStream, HGet
+	WorkBulkSearch,	//HSearchBatch, HRangeSearch
+	WorkInsert,	//HSet, HSetBatch, HSetStream, HDel
+	WorkPersist,	//periodic index persistence
+	WorkAdmin,	//DbNew, DbDel
+	WorkClasses
+};
+
+//limits of a work class, 0 for unlimited
+struct WorkLimits {
+	int concurrency;	//max running
+	double rate;	//max admitted per second
+	int queue;	//max waiting, more are rejected
+
+	WorkLimits():concurrency(0),rate(0),queue(0) {}
+};
+
+/**
+ * Admission schedules the work of the rpcs and the background threads in
+ * front of the dbs locks:
+ *		1) each class runs at most concurrency at once and is admitted at
+ *		   most rate per second, work beyond waits in the class queue
+ *		2) inserts and persists yield to interactive searches: they wait
+ *		   while searches run or wait, at most yieldMs, so that the write
+ *		   preferring dbs locks do not stall searches behind a stream of writes
+ * Work is admitted before any lock is taken and never waits holding one.
+ */
+class Admission {
+	public:
+		struct ClassStats {
+			const char *name;
+			WorkLimits limits;
+			int running;
+			int waiting;
+			uint64_t admitted;
+			uint64_t rejected;	//queue full
+			uint64_t expired;	//deadline passed while waiting
+		};
+
+		Admission();
+
+		//limits "class=concurrency/rate/queue,...", e.g. "insert=2/1000/256",
+		//classes search, bulk_search, insert, persist and admin.
+		//yieldMs: max wait of inserts and persists for searches, 0 never yields.
+		//return -1 on a bad limits string
+		int init(const std::string &limits, int yieldMs);
+
+		//wait until cls may run. deadline may be NULL.
+		//return 0, RESOURCE_EXHAUSTED if the class queue is full
+		//or DEADLINE_EXCEEDED if deadline expired while waiting
+		int enter(WorkClass cls, const Deadline *deadline);
+
+		//the work entered with cls is done
+		void leave(WorkClass cls);
+
+		void stats(std::vector<ClassStats> *out);
+
+		static const char *className(WorkClass cls);
+
+		//error message of an enter error
+		static const char *errorMsg(int rc);
+
+	private:
+		typedef std::chrono::steady_clock Clock;
+
+		struct ClassState {
+			WorkLimits limits;
+			int running;
+			int waiting;
+			//token bucket of the rate limit
+			double tokens;
+			Clock::time_point refilled;
+			uint64_t admitted;
+			uint64_t rejected;
+			uint64_t expired;
+			ClassState():running(0),waiting(0),tokens(0),admitted(0),rejected(0),expired(0) {}
+		};
+
+		//true if cls waiting since since may run now, else
+		//*wait is the time to the next check.
+		//should call with mutex
+		bool ready(WorkClass cls, Clock::time_point since, Clock::time_point now, Clock::duration *wait);
+
+		std::mutex mutex;
+		std::condition_variable cond;
+		ClassState states[WorkClasses];
+		Clock::duration yield;
+		int waiters;
+};
+
+//admission of one piece of work, left when destroyed
+class AdmissionTicket {
+	public:
+		//admission NULL admits everything
+		AdmissionTicket(Admission *admission, WorkClass cls, const Deadline *deadline);
+		~AdmissionTicket();
+
+		//result of Admission::enter
+		int rc() const {
+			return code;
+		}
+
+	private:
+		Admission *admission;
+		WorkClass cls;
+		int code;
+};
+
+#endif
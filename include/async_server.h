@@ -0,0 +1,103 @@
+#ifndef ASYNC_SERVER_H
+#define ASYNC_SERVER_H
+
+#include <memory>
+#include <vector>
+#include <thread>
+#include <google/protobuf/arena.h>
+#include "faiss_logic.h"
+#include "worker_pool.h"
+
+//first arena block of a call, enough for the messages of most calls
+static const size_t CallArenaBlock = 8192;
+
+//arena options using the block of a call
+inline google::protobuf::ArenaOptions arenaOptions(char *block) {
+	google::protobuf::ArenaOptions options;
+	options.initial_block = block;
+	options.initial_block_size = CallArenaBlock;
+	return options;
+}
+
+/**
+ * AsyncServer serves the unary rpcs of FaissServiceImpl on grpc completion
+ * queues instead of the grpc sync thread pool:
+ *		1) --cq_threads completion queues, each polled by its own thread
+ *		2) a polled rpc is handed to the worker pool of its class:
+ *		   search (HSearch HSearchBatch HSearchMulti HGet), write (HSet HSetBatch HDel),
+ *		   admin (Ping DbNew DbDel DbList)
+ *		3) a full pool queue fails the rpc with RESOURCE_EXHAUSTED at once,
+ *		   so a burst of writes can not delay the searches
+ *
+ * The streaming rpcs HSearchStream, HRangeSearch and HSetStream stay sync handlers.
+ */
+class AsyncServer {
+	public:
+		explicit AsyncServer(FaissServiceImpl *impl);
+		~AsyncServer();
+
+		//register the service and the completion queues, before BuildAndStart
+		void registerTo(ServerBuilder *builder);
+
+		//start the polling threads, after BuildAndStart
+		void start();
+
+		//call after Server::Shutdown
+		void stop();
+
+		//forward the streaming rpcs to FaissServiceImpl.
+		//WithAsyncMethod_* only have default constructors, bind sets impl
+		class StreamService : public FaissService::Service {
+			public:
+				StreamService():impl(NULL) {}
+
+				void bind(FaissServiceImpl *impl) {
+					this->impl = impl;
+				}
+
+				Status HSearchStream(ServerContext* context, ServerReaderWriter< ::faiss_server::HSearchResponse, ::faiss_server::HSearchRequest>* stream) override {
+					return impl->HSearchStream(context, stream);
+				}
+
+				Status HRangeSearch(ServerContext* context, const ::faiss_server::HRangeSearchRequest* request, ServerWriter< ::faiss_server::HRangeSearchResponse>* writer) override {
+					return impl->HRangeSearch(context, request, writer);
+				}
+
+				Status HSetStream(ServerContext* context, ServerReader< ::faiss_server::HSetRequest>* reader, ::faiss_server::HSetStreamResponse* response) override {
+					return impl->HSetStream(context, reader, response);
+				}
+
+			private:
+				FaissServiceImpl *impl;
+		};
+
+		typedef FaissService::WithAsyncMethod_Ping<
+			FaissService::WithAsyncMethod_DbNew<
+			FaissService::WithAsyncMethod_DbDel<
+			FaissService::WithAsyncMethod_DbList<
+			FaissService::WithAsyncMethod_HSet<
+			FaissService::WithAsyncMethod_HSetBatch<
+			FaissService::WithAsyncMethod_HDel<
+			FaissService::WithAsyncMethod_HGet<
+			FaissService::WithAsyncMethod_HSearch<
+			FaissService::WithAsyncMethod_HSearchBatch<
+			FaissService::WithAsyncMethod_HSearchMulti<StreamService> > > > > > > > > > > MixedService;
+
+	private:
+		//post one waiting call of every unary rpc on cq
+		void requestCalls(grpc::ServerCompletionQueue *cq);
+
+		//poll cq until it is shut down
+		void poll(grpc::ServerCompletionQueue *cq);
+
+		FaissServiceImpl *impl;
+		MixedService service;
+		std::unique_ptr<WorkerPool> searchPool;
+		std::unique_ptr<WorkerPool> writePool;
+		std::unique_ptr<WorkerPool> adminPool;
+		std::vector<std::unique_ptr<grpc::ServerCompletionQueue> > cqs;
+		std::vector<std::thread> pollers;
+		bool stopped;
+};
+
+#endif
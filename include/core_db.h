@@ -5,10 +5,48 @@
 #include "utils.h"
 #include <atomic>
 #include <sstream>
+#include <functional>
 #include <gflags/gflags.h>
 #include <glog/logging.h>
 #include "lmdb/lmdb.h"
 
+//durability of the lmdb commits, same values as DbNewRequest.Durability
+enum LmdbDurability {
+	LmdbSync = 1,	//fsync data and meta pages on every commit
+	LmdbNoMetaSync = 2,	//fsync data pages only, the last commit may be lost on a crash
+	LmdbNoSync = 3,	//no fsync, the commits since the last periodic sync may be lost
+};
+
+//lmdb env options of a db
+struct LmdbOptions {
+	int durability;	//LmdbDurability
+	bool writeMap;	//MDB_WRITEMAP, write to the memory map instead of by write()
+	bool noReadahead;	//MDB_NORDAHEAD, for random reads of a db larger than memory
+
+	//the server defaults of --lmdb_durability, --lmdb_writemap and --lmdb_nordahead
+	LmdbOptions();
+};
+
+//sub-databases of the records of the features, MDB_INTEGERKEY
+//with the feature id as native size_t key
+enum IdDb {
+	IdFeatures = 0,	//raw features
+	IdTags,	//tags of the features
+	IdDbs
+};
+
+//a put of lmdbWrite, to key of the main database or to id of an IdDb
+struct LmdbPut {
+	const char *key;	//NULL for id
+	int db;	//IdDb of id
+	size_t id;
+	const void *val;
+	size_t len;
+
+	LmdbPut(const char *key, const void *val, size_t len):key(key),db(0),id(0),val(val),len(len) {}
+	LmdbPut(int db, size_t id, const void *val, size_t len):key(NULL),db(db),id(id),val(val),len(len) {}
+};
+
 class LmDB {
 	public:
 		//database name
@@ -18,25 +56,79 @@ class LmDB {
 		//ntotal of index should less than maxSize
 		size_t maxSize;
 
-		LmDB(std::string &dbName, size_t maxSize);
+		LmDB(std::string &dbName, size_t maxSize, const LmdbOptions &options = LmdbOptions());
 		~LmDB();
+
+		//flush the commits of a NoMetaSync or NoSync env, return 0 on success
+		int lmdbSync();
+
+		//true if commits are not durable until lmdbSync
+		bool lmdbLazySync() const {
+			return options.durability != LmdbSync;
+		}
+
+		//size the map for maxSize features of dimension d,
+		//should call without transactions of this env
+		int setMapDimension(int d);
 	private:
 		int initLmdb();
 		
-		size_t getMapSize();
+		size_t getMapSize(int d);
+
+		//reader slots, one per thread reading the env
+		static unsigned int maxReaders();
+
+		LmdbOptions options;
 	protected:
 		MDB_env *m_env;
 		MDB_dbi *m_dbi;
+		//valid after openIdDbs
+		MDB_dbi idDbis[IdDbs];
+
+		//open the IdDb sub-databases, created if missing
+		int openIdDbs();
+
+		//all puts in one write transaction. an id above the last id of its
+		//sub-database is appended with MDB_APPEND
+		int lmdbWrite(const LmdbPut *puts, size_t n);
+
+		//value of id in db, valid until the id is written or deleted
+		int idGet(int db, size_t id, void **val, int *val_len);
+
+		//lmdbGetBatch of ids in db
+		int idGetBatch(int db, const long *ids, size_t n, void *vals, size_t valLen, int *rcs);
+
+		int idDel(int db, size_t id);
+
+		//call fn on every id of db in id order, in one read transaction.
+		//val is only valid inside fn
+		int idScan(int db, std::function<void(size_t id, const void *val, size_t len)> fn);
+
+		//move the records prefix + encodeID(id) of the main database to id of db,
+		//in transactions of batch records. *moved is the number moved
+		int lmdbMigrateIds(const std::string &prefix, int db, size_t batch, size_t *moved);
 			
 		int lmdbSet(const char *key, char *val);
 		int lmdbSet(const char *key, void *val, int len);
 		int lmdbSet(const char *key1, void *val1, int len1, const char *key2, void *val2, int len2); 
 
+		//put n key values in one write transaction
+		int lmdbSetMulti(const char **keys, void **vals, const int *lens, size_t n);
+
 		int lmdbDel(const char *key);
 		
 		int lmdbGet(const char *key, std::string *val, int *val_len);
 		int lmdbGet(const char *key, void **val, int *val_len);
 
+		//get n values in one read transaction, value i is copied to vals + i * valLen.
+		//rcs[i] is 0, MDB_NOTFOUND, or -1 if the stored value length is not valLen
+		int lmdbGetBatch(const char **keys, size_t n, void *vals, size_t valLen, int *rcs);
+
+		//call fn on every key starting with prefix in key order, in one read
+		//transaction. val is only valid inside fn
+		int lmdbScan(const std::string &prefix,
+				std::function<void(const char *key, size_t keyLen, const void *val, size_t len)> fn);
+
 };
 
 #endif
@@ -0,0 +1,48 @@
+#ifndef DB_TUNER_H
+#define DB_TUNER_H
+
+#include <vector>
+#include "faiss_db.h"
+
+/**
+ * DbTuner picks the search operating point of a db:
+ *		1) sample TuneQueries stored features from lmdb as queries
+ *		2) compute their exact TuneTopK neighbors by a brute force scan of lmdb
+ *		3) explore nprobe x refineFactor with faiss::ParameterSpace,
+ *		   measure recall@TuneTopK and latency, keep the pareto frontier
+ *		   in faiss::OperatingPoints
+ *		4) choose the cheapest point reaching the db targetRecall
+ *
+ * Searches go through FaissDB::searchIndex with explicit probes,
+ * the serving index is never changed.
+ */
+class DbTuner {
+	public:
+		explicit DbTuner(FaissDB *db);
+
+		//return true if the db asks for tuning and grew enough since the last one
+		static bool needTune(FaissDB *db);
+
+		//tune and store the chosen point in the db.
+		//return 0 on success, CANCELLED if the db was dropped meanwhile
+		int tune();
+
+	private:
+		//sample queries from lmdb, return the number of queries
+		size_t sampleQueries();
+
+		//exact neighbors of the queries
+		int groundTruth(std::vector<float> *gtD, std::vector<faiss::Index::idx_t> *gtI);
+
+		//search all queries with one operating point, like HSearch does
+		void searchAll(int nprobe, int refineFactor,
+				std::vector<float> *D, std::vector<faiss::Index::idx_t> *I);
+
+		FaissDB *db;
+		int d;
+		bool ip;
+		size_t nq;
+		std::vector<float> queries;
+};
+
+#endif
@@ -0,0 +1,50 @@
+#ifndef DEADLINE_H
+#define DEADLINE_H
+
+#include <chrono>
+#include <grpc++/grpc++.h>
+#include "ivfpq_scan.h"
+#include "utils.h"
+
+/**
+ * Deadline of a rpc: the deadline set by the client and, on the sync
+ * server, the cancellation of the call. Searches check it before taking
+ * locks, between their stages and between inverted lists, so that no cpu
+ * is spent on answers nobody waits for.
+ */
+class Deadline: public ScanStop {
+	public:
+		//context NULL never expires
+		explicit Deadline(grpc::ServerContext *context):context(context),has(false),checkCancel(false) {
+			if (NULL == context) {
+				return;
+			}
+			at = context->deadline();
+			has = at != std::chrono::system_clock::time_point::max();
+			//IsCancelled of async calls needs AsyncNotifyWhenDone
+			checkCancel = !globalConfig.AsyncServer;
+		}
+
+		//true if the client deadline passed or the call was cancelled
+		bool expired() const {
+			if (NULL == context) {
+				return false;
+			}
+			if (has && std::chrono::system_clock::now() >= at) {
+				return true;
+			}
+			return checkCancel && context->IsCancelled();
+		}
+
+		bool stop() const override {
+			return expired();
+		}
+
+	private:
+		grpc::ServerContext *context;
+		bool has;
+		bool checkCancel;
+		std::chrono::system_clock::time_point at;
+};
+
+#endif
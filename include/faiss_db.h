@@ -3,16 +3,82 @@
 
 #include "core_db.h"
 #include "faiss_def.grpc.pb.h"
-#include "faiss/gpu/StandardGpuResources.h"
-#include "faiss/gpu/GpuIndexIVFPQ.h"
-#include "faiss/gpu/GpuAutoTune.h"
+#include "faiss_index.h"
+#include "search_batcher.h"
+#include "result_cache.h"
+#include "group_writer.h"
+#include "tag_store.h"
+#include "wal.h"
+#include <mutex>
+#include <deque>
+#include <thread>
+#include <condition_variable>
 #include "faiss/IndexIVFPQ.h"
 #include "faiss/IndexFlat.h"
 #include "faiss/index_io.h"
 #include "faiss/AuxIndexStructures.h"
 
 using namespace faiss;
-using namespace faiss::gpu;
+
+typedef faiss_server::DbNewRequest::MetricType DbMetric;
+
+/**
+ * db options, stored in the global lmdb as
+ *		DB:${dbName} -> modelPath##maxSize##device##metric##refineFactor##targetRecall
+ *			##durability##writeMap##noReadahead
+ * modelPath: faiss index使用的模型路径
+ * maxSize: max number of features
+ * device: index device, cpu or gpu
+ * metric: L2, InnerProduct or Cosine
+ * refineFactor: searches re-rank topk * refineFactor candidates by exact
+ *		distances of the raw features, 0 for no refine
+ * targetRecall: DbTuner picks the cheapest nprobe and refineFactor reaching
+ *		this recall, 0 for no tuning
+ * durability: LmdbDurability of the db lmdb, 0 for --lmdb_durability
+ * writeMap, noReadahead: MDB_WRITEMAP and MDB_NORDAHEAD, also set for all dbs
+ *		by --lmdb_writemap and --lmdb_nordahead
+ */
+struct DbMeta {
+	std::string modelPath;
+	size_t maxSize;
+	std::string device;
+	DbMetric metric;
+	int refineFactor;
+	float targetRecall;
+	int durability;
+	bool writeMap;
+	bool noReadahead;
+
+	DbMeta();
+
+	//lmdb env options, the server defaults for the unset ones
+	LmdbOptions lmdbOptions() const;
+
+	std::string encode() const;
+
+	//fields missing in records of older versions keep their defaults
+	void decode(const std::string &val);
+};
+
+/**
+ * search operating point chosen by DbTuner, stored in the db lmdb as
+ *		TUNED_POINT -> nprobe##refineFactor##recall##latencyMs##ntotal
+ */
+struct TunedPoint {
+	int nprobe;	//0 if the db is not tuned
+	int refineFactor;
+	float recall;	//measured recall at the point
+	float latencyMs;	//measured latency per query
+	size_t ntotal;	//index size when tuned
+
+	TunedPoint();
+
+	std::string encode() const;
+
+	//return -1 on a bad record
+	int decode(const std::string &val);
+};
+
 class FaissDB:public LmDB {
 	public:
 
@@ -20,21 +86,27 @@ class FaissDB:public LmDB {
 		 * dbName: 业务层数据库名称
 		 *		faiss index 持久化默认地址： ./data/${dbName}.index
 		 *		faiss raw feature 持久化默认地址: ./data/${dbName}/data.mdb
-		 * modelPath: faiss index使用的模型路径
-		 * maxSize: max number of features
-		 * gpuLock: global lock for all dbs when communicate with GPU
+		 * meta: db options
 		 */
-		FaissDB(std::string &dbName, 
-			std::string &modelPath, 
-			size_t maxSize,
-			WfirstRWLock *gpuLock);
+		FaissDB(std::string &dbName, const DbMeta &meta);
 		~FaissDB();
 
 		//initialize
 		int init();
 
-		//add feature
-		int addFeature(float *feature, const size_t len, long *feaID);
+		//add feature with its ntags integer tags
+		int addFeature(const float *feature, const size_t len, const int32_t *tags, size_t ntags, long *feaID);
+
+		//add n features of the db dimension with the contiguous ids from *firstID,
+		//in one index add and one lmdb transaction. tags holds ntags tags per
+		//feature, NULL if ntags is 0.
+		//with a wal both adds return once the features are in the wal,
+		//the ingester thread stores and indexes them later
+		int addFeatures(const float *features, size_t n, const int32_t *tags, size_t ntags, long *firstID);
+
+		//wait until the ids up to id are searchable, at most --ingest_wait_ms
+		//or until stop says so. return 0 or DEADLINE_EXCEEDED
+		int waitIngested(long id, const ScanStop *stop);
 
 		//get feature
 		int getFeature(const size_t feaID, float **feature, size_t *len);
@@ -42,6 +114,50 @@ class FaissDB:public LmDB {
 		//delete feature
 		int delFeature(const size_t feaID);
 
+		//L2-normalize n vectors in place for Cosine dbs
+		void normalize(float *x, size_t n);
+
+		//n query vectors of the feature bytes of a request, read in place
+		//if possible. Cosine dbs normalize a copy in buf
+		const float *prepareQueries(const std::string &bytes, size_t n, std::vector<float> *buf);
+
+		//convert a distance from the index to the score returned to clients
+		float toScore(float dis);
+
+		//inverse of toScore
+		float toDistance(float score);
+
+		//search n queries in the index directly,
+		//nprobe <= 0 for the default probes. the scan stops early
+		//when stop says so, NULL never stops
+		void searchIndex(faiss::Index::idx_t n, const float *x, faiss::Index::idx_t k,
+				int nprobe, const ScanStop *stop, float *dis, faiss::Index::idx_t *nns);
+
+		//find the ids within radius of one query, radius is a distance in the
+		//index metric. only the maxResults nearest are kept while scanning,
+		//truncated is set if there were more. the scan stops early when stop
+		//says so, NULL never stops.
+		//return -1 if the index does not support range search
+		int rangeSearch(const float *x, float radius, size_t maxResults, int nprobe,
+				const ScanStop *stop, faiss::RangeSearchResult *res, bool *truncated);
+
+		//resolve the nprobe and refineFactor of a search, 0 for the
+		//defaults: the tuned point if any, else --nprobes and refineFactor
+		void searchParams(int *nprobe, int *refineFactor);
+
+		//search one query, may be batched with concurrent queries.
+		//an unbatched scan stops early when stop says so, NULL never stops.
+		//return 0 on success
+		int searchOne(const float *x, faiss::Index::idx_t k, int nprobe, const ScanStop *stop,
+				float *dis, faiss::Index::idx_t *nns);
+
+		//search one query without batching among the ids whose tags match
+		//filters (NULL for all ids), the filters and stop are checked while
+		//scanning the lists
+		void searchDirect(const float *x, faiss::Index::idx_t k, int nprobe,
+				const std::vector<TagFilter> *filters, const ScanStop *stop,
+				float *dis, faiss::Index::idx_t *nns);
+
 		//persist faiss index 
 		int persistIndex();
 		
@@ -49,20 +165,40 @@ class FaissDB:public LmDB {
 		//1) load blackList from lmdb
 		//2) load cpu index from $(dbName).index file
 		//3) remove blackList ids from cpu index if the list is not null
-		//4) load gpu index from cpu index
+		//4) load the serving index of the db device from cpu index
 		//5) update some status, maxID,maxPersistID .et
-		//5) load lost feature to gpu index
+		//5) load lost feature to the index
 		//6) persist the index
-		int reload(StandardGpuResources *rs);
+		int reload();
 		
 		//check weather the given feaID is in the blackList
+		//should call with a readlock
 		bool inBlackList(long feaId);
 
+		//number of ids in the blackList
+		//should call with a readlock
+		size_t blackListSize();
+
 		//load faiss index
-		int loadIndex(StandardGpuResources *rs, std::string &idxPath);
+		int loadIndex(std::string &idxPath);
+
+		//计算输入p1与lmdb中n个ID的cosine距离, 在一个lmdb读事务中完成
+		//rcs[i]: 0, MDB_NOTFOUND or DIMENSION_NOT_EQUAL
+		int calcCosines(const float *p1, const long *ids, size_t n, float *dis, int *rcs);
+
+		//计算输入p1与lmdb中n个ID在index metric下的精确距离, 在一个lmdb读事务中完成
+		//rcs[i]: 0, MDB_NOTFOUND or DIMENSION_NOT_EQUAL
+		int refineDistances(const float *p1, const long *ids, size_t n, float *dis, int *rcs);
+
+		//read the raw features of n ids in one lmdb transaction,
+		//features should have room for n * d floats
+		int getFeatures(const long *ids, size_t n, float *features, int *rcs);
 
-		//计算输入p1与lmdb中的某个ID的cosine距离		
-		int calcCosine(const float *p1, long id, float *dis);
+		//the current tuned point
+		TunedPoint tunedPoint();
+
+		//use and store a new tuned point
+		int setTunedPoint(const TunedPoint &point);
 
 		//内部基础状态信息
 		void status();
@@ -81,9 +217,67 @@ class FaissDB:public LmDB {
 		
 		//从lmdb中加载未持久化的特征到index中
 		int loadLostIndex();
+
+		//load the tuned point from lmdb
+		int loadTunedPoint();
+
+		//load the tags of all features from lmdb
+		int loadTags();
+
+		//move the features and tags stored at decimal keys
+		//by older versions to the id databases
+		int migrateKeys();
+
+		//store n features with the ids from firstID, their tags and MAX_ID
+		//in one lmdb transaction
+		int storeFeatures(const float *features, size_t n, const int32_t *tags, size_t ntags, long firstID);
+
+		//allocate the ids of n features, append them to the wal and
+		//queue them for the ingester
+		int appendWal(const float *features, size_t n, const int32_t *tags, size_t ntags, long *firstID);
+
+		//ingester thread: store the queued features in lmdb, then add them to the index
+		void ingestLoop();
+
+		//store the wal records after the lmdb MAX_ID in lmdb
+		int replayWal();
+
+		//features appended to the wal, waiting for the ingester
+		struct IngestBatch {
+			long firstID;
+			size_t n;
+			size_t ntags;
+			std::vector<float> features;
+			std::vector<int32_t> tags;
+		};
 		
 	public:
-		GpuIndexIVFPQ *index;
+		//serving index, owned by backend
+		faiss::Index *index;
+
+		//cpu or gpu index backend
+		IndexBackend *backend;
+
+		//index device, cpu or gpu
+		std::string device;
+
+		//L2, InnerProduct or Cosine
+		DbMetric metric;
+
+		//default refine factor of searches, 0 for no refine
+		int refineFactor;
+
+		//recall the tuned point should reach, 0 for no tuning
+		float targetRecall;
+
+		//guarded by lock
+		TunedPoint tuned;
+
+		//held by DbTuner while tuning the db
+		std::mutex tuneMutex;
+
+		//set by DbDel, a running tuning stops
+		std::atomic<bool> dropped;
 
 		//index persist path
 		std::string persistPath;
@@ -106,10 +300,50 @@ class FaissDB:public LmDB {
 
 		//the deleted ids are stored in blackList. Compack the data when the length
 		//of blackList is sufficiently large.
+		//blackList is the sorted copy persisted in lmdb, index scans
+		//check the same ids in deleted.
 		std::set<long> blackList;
+		IdBitmap deleted;
+
+		//tags of the features, guarded by lock
+		TagStore tags;
 
-		//share lock for index
+		//share lock for index and blackList of this db,
+		//searches take the readlock, add/delete/persist/reload take the writelock
 		WfirstRWLock *lock;
+
+		//coalesce concurrent searchOne calls
+		SearchBatcher *batcher;
+
+		//bumped by every change of the searchable features, after the
+		//change and under the writelock
+		std::atomic<uint64_t> writeEpoch;
+
+		//search results of the current writeEpoch, NULL if disabled
+		ResultCache *cache;
+
+		//commits concurrent HSet adds in groups by addFeatures, NULL if disabled
+		GroupWriter *groupWriter;
+
+		//write-ahead log of the adds, NULL if --wal_dir is not set
+		Wal *wal;
+
+		//ids up to ingestedID are in lmdb and the index, set under the writelock
+		std::atomic<long> ingestedID;
+
+	private:
+		//serializes the id allocation and the wal appends
+		std::mutex walMutex;
+
+		//guards the ingest queue
+		std::mutex ingestMutex;
+		std::condition_variable condIngest;
+		std::condition_variable condIngested;
+		std::deque<IngestBatch> ingestQueue;
+		//features appended but not ingested
+		size_t ingestPending;
+		std::atomic<bool> ingestStopping;
+		std::thread ingester;
 };
 
 #endif
\ No newline at end of file
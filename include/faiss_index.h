@@ -0,0 +1,72 @@
+#ifndef FAISS_INDEX_BACKEND_H
+#define FAISS_INDEX_BACKEND_H
+
+#include <string>
+#include <sstream>
+#include "faiss/IndexIVFPQ.h"
+#include "faiss/index_io.h"
+#include "ivfpq_scan.h"
+
+//index devices, stored with the db meta record
+static std::string SDeviceCPU = "cpu";
+static std::string SDeviceGPU = "gpu";
+
+/**
+ * IndexBackend owns the faiss index serving a FaissDB,
+ * so that the db logic does not depend on where the index lives.
+ *		cpu: faiss::IndexIVFPQ searched in host memory
+ *		gpu: faiss::gpu::GpuIndexIVFPQ, only if built with FAISS_SERVER_GPU
+ */
+class IndexBackend {
+	public:
+		virtual ~IndexBackend() {}
+
+		//build the serving index from an index read from disk.
+		//the backend takes ownership of cpuIndex.
+		virtual int load(faiss::IndexIVFPQ *cpuIndex) = 0;
+
+		//the serving index, NULL before load
+		virtual faiss::Index *getIndex() = 0;
+
+		//search n queries with params.nprobe probes, nprobe <= 0 for the
+		//default set by setNumProbes. params.deleted ids and the ids rejected
+		//by params.filter are not returned.
+		//safe to call from concurrent threads
+		virtual void search(faiss::Index::idx_t n, const float *x, faiss::Index::idx_t k,
+				const ScanParams &params, float *dis, faiss::Index::idx_t *nns) = 0;
+
+		//find the ids of n queries within radius in the index metric, at most
+		//the maxResults nearest per query. truncated[i] is set if query i had more.
+		//return -1 if the backend does not support range search
+		virtual int rangeSearch(faiss::Index::idx_t n, const float *x, float radius,
+				size_t maxResults, const ScanParams &params, faiss::RangeSearchResult *res,
+				bool *truncated) = 0;
+
+		//add n vectors with ids, caller should exclude concurrent searches
+		virtual void add(faiss::Index::idx_t n, const float *x, const long *ids) = 0;
+
+		//set the default nprobe of searches
+		virtual void setNumProbes(int nprobe) = 0;
+
+		//number of inverted lists
+		virtual int numLists() = 0;
+
+		//max k of search
+		virtual faiss::Index::idx_t maxK() = 0;
+
+		//write the serving index to path
+		virtual void write(const std::string &path) = 0;
+
+		//dump the inverted lists
+		virtual void status(std::ostringstream &oss) = 0;
+
+		virtual const std::string &device() = 0;
+};
+
+//return true if device is supported by this build
+bool validDevice(const std::string &device);
+
+//create the backend for device, NULL if not supported
+IndexBackend *newIndexBackend(const std::string &device);
+
+#endif
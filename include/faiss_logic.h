@@ -7,10 +7,16 @@
 #include <grpc++/grpc++.h>
 #include <pthread.h>
 #include "faiss_db.h"
+#include "worker_pool.h"
+#include "admission.h"
+#include "deadline.h"
 
 using grpc::Server;
 using grpc::ServerBuilder;
 using grpc::ServerContext;
+using grpc::ServerWriter;
+using grpc::ServerReader;
+using grpc::ServerReaderWriter;
 using grpc::Status;
 using faiss_server::FaissService;
 
@@ -18,18 +24,27 @@ class FaissServiceImpl final : public FaissService::Service, public LmDB {
 	private:
 		std::map<std::string, FaissDB*> dbs;
 
-		StandardGpuResources *m_resources;
-		
 		//share lock for dbs
 		WfirstRWLock *m_lock;
 
-		//all dbs share only one gpu_lock
-		WfirstRWLock *gpu_lock;
+		//searches the dbs of HSearchMulti in parallel
+		std::unique_ptr<WorkerPool> fanoutPool;
+
+		//searches the queries of all HSearchStream streams
+		std::unique_ptr<WorkerPool> streamPool;
+
+		//schedules rpcs and persistence before they take the locks
+		std::unique_ptr<Admission> admission;
 		
 		int InitServer();
 
 		//load dbs from persist storage
 		int LoadLocalDBs();
+
+		//search one query of HSearch or HSearchStream
+		//deadline may be NULL
+		Status SearchOne(const ::faiss_server::HSearchRequest* request, ::faiss_server::HSearchResponse* response,
+				const Deadline *deadline);
 	public:
 		FaissServiceImpl();
 		
@@ -37,6 +52,12 @@ class FaissServiceImpl final : public FaissService::Service, public LmDB {
 	
 		//周期持久化faiss index	
 		static void PersistIndexPeriod(FaissServiceImpl *handle, const unsigned int duration);	
+
+		//周期检查并调优db的检索参数
+		static void TuneDbsPeriod(FaissServiceImpl *handle, const unsigned int duration);
+
+		//周期sync nometasync和nosync db的lmdb, durationMs毫秒
+		static void SyncLmdbPeriod(FaissServiceImpl *handle, const unsigned int durationMs);
 		
 		//注意 修改此处，需要make clean ，再make
 		Status Ping(ServerContext* context, const ::faiss_server::PingRequest* request, ::faiss_server::PingResponse* response) override;
@@ -45,10 +66,22 @@ class FaissServiceImpl final : public FaissService::Service, public LmDB {
 		
 		Status HSet(ServerContext* context, const ::faiss_server::HSetRequest* request, ::faiss_server::HSetResponse* response) override;
 		
+		Status HSetBatch(ServerContext* context, const ::faiss_server::HSetBatchRequest* request, ::faiss_server::HSetBatchResponse* response) override;
+
+		Status HSetStream(ServerContext* context, ServerReader< ::faiss_server::HSetRequest>* reader, ::faiss_server::HSetStreamResponse* response) override;
+		
 		Status HDel(ServerContext* context, const ::faiss_server::HGetDelRequest* request, ::faiss_server::EmptyResponse* response) override;
 		
 		Status HSearch(ServerContext* context, const ::faiss_server::HSearchRequest* request, ::faiss_server::HSearchResponse* response) override;
 		
+		Status HSearchBatch(ServerContext* context, const ::faiss_server::HSearchBatchRequest* request, ::faiss_server::HSearchBatchResponse* response) override;
+		
+		Status HSearchMulti(ServerContext* context, const ::faiss_server::HSearchMultiRequest* request, ::faiss_server::HSearchMultiResponse* response) override;
+		
+		Status HSearchStream(ServerContext* context, ServerReaderWriter< ::faiss_server::HSearchResponse, ::faiss_server::HSearchRequest>* stream) override;
+		
+		Status HRangeSearch(ServerContext* context, const ::faiss_server::HRangeSearchRequest* request, ServerWriter< ::faiss_server::HRangeSearchResponse>* writer) override;
+		
 		Status DbList(ServerContext* context, const ::faiss_server::DbListRequest* request, ::faiss_server::DbListResponse* response) override;
 		
 		Status DbDel(ServerContext* context, const ::faiss_server::DbDelRequest* request, ::faiss_server::EmptyResponse* response) override;
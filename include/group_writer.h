@@ -0,0 +1,70 @@
+#ifndef GROUP_WRITER_H
+#define GROUP_WRITER_H
+
+#include <vector>
+#include <mutex>
+#include <thread>
+#include <functional>
+#include <stdint.h>
+#include <condition_variable>
+
+/**
+ * GroupWriter commits the concurrent single feature adds of one db in groups.
+ *
+ * Each add enqueues its feature and waits. The writer thread takes the
+ * queue as soon as it holds maxGroup features, or maxWaitUs microseconds
+ * after it woke up for the first one, and writes the whole group with one
+ * WriteFunc call: one index add and one lmdb transaction. Every add of the
+ * group returns after that shared commit, with the same result code.
+ */
+class GroupWriter {
+	public:
+		//add n features, tags holds ntags tags per feature.
+		//ids are contiguous from *firstID. return 0 on success
+		typedef std::function<int(const float *features, size_t n,
+				const int32_t *tags, size_t ntags, long *firstID)> WriteFunc;
+
+		GroupWriter(WriteFunc func, int maxGroup, int maxWaitUs);
+
+		//writes the queued features and stops the writer thread
+		~GroupWriter();
+
+		//add one feature of dimension d with ntags tags, and wait for the
+		//commit of its group. d is the same for all adds.
+		//return the result of the group and *id
+		int add(const float *feature, int d, const int32_t *tags, size_t ntags, long *id);
+
+	private:
+		struct Pending {
+			const float *x;
+			int d;
+			const int32_t *tags;
+			size_t ntags;
+			long id;
+			int rc;
+			bool done;
+		};
+
+		//writer thread
+		void loop();
+
+		//write one group, should call without mutex
+		int write(const std::vector<Pending*> &group, long *firstID);
+
+		WriteFunc func;
+		size_t maxGroup;
+		int maxWaitUs;
+
+		std::mutex mutex;
+		std::condition_variable condQueue;
+		std::condition_variable condDone;
+		std::vector<Pending*> queue;
+		bool stopping;
+
+		//buffers of the writer thread
+		std::vector<float> features;
+		std::vector<int32_t> tags;
+		std::thread writer;
+};
+
+#endif
@@ -0,0 +1,108 @@
+#ifndef IVFPQ_SCAN_H
+#define IVFPQ_SCAN_H
+
+#include <vector>
+#include <stdint.h>
+#include "faiss/IndexIVFPQ.h"
+#include "faiss/AuxIndexStructures.h"
+
+/**
+ * IdBitmap marks the deleted ids of a db, so that index scans skip
+ * them with one bit test. ids are dense from 1, bit i is id i.
+ */
+class IdBitmap {
+	public:
+		IdBitmap():count(0) {}
+
+		bool contains(long id) const {
+			size_t w = (size_t)id >> 6;
+			return id >= 0 && w < words.size() && ((words[w] >> (id & 63)) & 1);
+		}
+
+		void set(long id) {
+			if (id < 0 || contains(id)) {
+				return;
+			}
+			size_t w = (size_t)id >> 6;
+			if (w >= words.size()) {
+				words.resize(w + 1, 0);
+			}
+			words[w] |= (uint64_t)1 << (id & 63);
+			count ++;
+		}
+
+		void clear() {
+			words.clear();
+			count = 0;
+		}
+
+		//number of ids set
+		size_t size() const {
+			return count;
+		}
+
+	private:
+		std::vector<uint64_t> words;
+		size_t count;
+};
+
+//predicate on the ids of a scan, checked before the distance computation
+class IdFilter {
+	public:
+		virtual ~IdFilter() {}
+
+		virtual bool accept(long id) const = 0;
+};
+
+//asks a scan to stop early, checked before each inverted list
+class ScanStop {
+	public:
+		virtual ~ScanStop() {}
+
+		virtual bool stop() const = 0;
+};
+
+//parameters of one index scan
+struct ScanParams {
+	int nprobe;
+	//ids skipped by the scan, may be NULL
+	const IdBitmap *deleted;
+	//only ids accepted by filter are returned, NULL for all
+	const IdFilter *filter;
+	//a stopped scan returns the results of the lists scanned so far, NULL never stops
+	const ScanStop *stop;
+
+	ScanParams():nprobe(1),deleted(NULL),filter(NULL),stop(NULL) {}
+
+	//true if id is skipped by the scan
+	bool skip(long id) const {
+		return (deleted != NULL && deleted->contains(id)) ||
+			(filter != NULL && !filter->accept(id));
+	}
+};
+
+/**
+ * search n queries in a cpu IndexIVFPQ like IndexIVFPQ::search, but the
+ * probes and the filters are per call, and the filters are applied while
+ * scanning the inverted lists, so that the k results are all live ids.
+ * needs 8 bits pq codes, see ivfpqScannable.
+ */
+void ivfpqSearch(const faiss::IndexIVFPQ *index, faiss::Index::idx_t n, const float *x,
+		faiss::Index::idx_t k, const ScanParams &params, float *dis, faiss::Index::idx_t *nns);
+
+/**
+ * IndexIVFPQ has no range_search, find all ids of n queries within radius
+ * (distance < radius for L2, inner product > radius for inner product
+ * indexes) in the probed lists, as IndexIVFFlat::range_search does.
+ * at most the maxResults nearest ids are kept per query while scanning,
+ * truncated[i] (n flags, may be NULL) is set when query i had more.
+ * needs 8 bits pq codes, see ivfpqScannable.
+ */
+void ivfpqRangeSearch(const faiss::IndexIVFPQ *index, faiss::Index::idx_t n, const float *x,
+		float radius, size_t maxResults, const ScanParams &params,
+		faiss::RangeSearchResult *res, bool *truncated);
+
+//return true if ivfpqSearch and ivfpqRangeSearch support the index
+bool ivfpqScannable(const faiss::IndexIVFPQ *index);
+
+#endif
@@ -0,0 +1,70 @@
+#ifndef RESULT_CACHE_H
+#define RESULT_CACHE_H
+
+#include <list>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <stdint.h>
+#include <unordered_map>
+
+//one result of a cached search
+struct CachedHit {
+	long id;
+	float score;
+};
+
+/**
+ * ResultCache is a LRU cache of the final result lists of one db, keyed
+ * by the query bytes and the search options. Each entry remembers the
+ * write epoch of the db when its search started, an entry of an older
+ * epoch is stale and dropped on lookup, so adds and deletes invalidate
+ * the whole cache with one increment.
+ * Entries are evicted from the least recently used once the memory of
+ * the cache exceeds maxBytes.
+ */
+class ResultCache {
+	public:
+		struct Stats {
+			uint64_t hits;
+			uint64_t misses;
+			uint64_t evictions;
+			size_t bytes;
+			size_t entries;
+		};
+
+		explicit ResultCache(size_t maxBytes);
+
+		//true if hits of key is cached at epoch
+		bool get(const std::string &key, uint64_t epoch, std::vector<CachedHit> *hits);
+
+		//cache the hits of a search started at epoch
+		void put(const std::string &key, uint64_t epoch, const std::vector<CachedHit> &hits);
+
+		Stats stats();
+
+	private:
+		struct Entry {
+			std::string key;
+			uint64_t epoch;
+			std::vector<CachedHit> hits;
+		};
+		typedef std::list<Entry> EntryList;
+
+		//memory charged to an entry
+		static size_t entryBytes(const Entry &e);
+
+		void erase(std::unordered_map<std::string, EntryList::iterator>::iterator it);
+
+		std::mutex mutex;
+		size_t maxBytes;
+		size_t bytes;
+		//most recently used first
+		EntryList lru;
+		std::unordered_map<std::string, EntryList::iterator> entries;
+		uint64_t hits;
+		uint64_t misses;
+		uint64_t evictions;
+};
+
+#endif
@@ -0,0 +1,77 @@
+#ifndef SEARCH_BATCHER_H
+#define SEARCH_BATCHER_H
+
+#include <vector>
+#include <mutex>
+#include <memory>
+#include <functional>
+#include <condition_variable>
+#include "faiss/Index.h"
+
+/**
+ * SearchBatcher coalesces concurrent single query searches of one db
+ * into one batched index search.
+ *
+ * The first query arriving when no batch is open becomes the leader:
+ * it waits up to windowUs microseconds (or until maxBatch queries
+ * joined), then runs the whole batch with one SearchFunc call and hands
+ * the results back to the waiting followers.
+ * Only queries with the same nprobe share a batch.
+ */
+class SearchBatcher {
+	public:
+		typedef faiss::Index::idx_t idx_t;
+		typedef std::function<void(idx_t n, const float *x, idx_t k,
+				int nprobe, float *dis, idx_t *nns)> SearchFunc;
+
+		SearchBatcher(SearchFunc func, int windowUs, int maxBatch);
+		~SearchBatcher() = default;
+
+		//search k nearest neighbors of one query x of dimension d with
+		//nprobe probes, dis and nns should have room for k results.
+		//return 0 on success, -1 if the batched search failed
+		int search(const float *x, int d, idx_t k, int nprobe, float *dis, idx_t *nns);
+
+		//false if queries are searched alone anyway
+		bool enabled() const {
+			return windowUs > 0 && maxBatch > 1;
+		}
+
+	private:
+		struct Query {
+			const float *x;
+			idx_t k;
+			float *dis;
+			idx_t *nns;
+		};
+
+		struct Batch {
+			std::vector<Query> queries;
+			idx_t k;	//max k of queries
+			int nprobe;
+			bool done;
+			int rc;
+			Batch(int nprobe):k(0),nprobe(nprobe),done(false),rc(0) {}
+		};
+
+		//run the closed batch and publish the results
+		void run(Batch *batch, int d);
+
+		//search one query without batching
+		int searchAlone(const float *x, idx_t k, int nprobe, float *dis, idx_t *nns);
+
+		SearchFunc func;
+		int windowUs;
+		size_t maxBatch;
+
+		std::mutex mutex;
+		//leader waits on it for the batch to fill up
+		std::condition_variable condFull;
+		//followers wait on it for the batch to finish
+		std::condition_variable condDone;
+
+		//batch accepting new queries, NULL if none
+		std::shared_ptr<Batch> open;
+};
+
+#endif
@@ -0,0 +1,44 @@
+#ifndef SEARCH_RESULT_H
+#define SEARCH_RESULT_H
+
+#include <string>
+#include <vector>
+#include "faiss_def.pb.h"
+#include "result_cache.h"
+#include "faiss/Index.h"
+
+//one ranked result of a search
+struct Node {
+	::google::protobuf::uint64 id;
+	float score;
+};
+
+//buffers of the search rpcs, one per thread and reused by its requests,
+//so that a search does not allocate its query copy and results
+struct SearchScratch {
+	std::vector<float> queries;
+	std::vector<faiss::Index::idx_t> nns;
+	std::vector<float> dis;
+	std::vector<Node> nodes;
+	//result cache key and hits of searchDb
+	std::string cacheKey;
+	std::vector<CachedHit> cached;
+
+	//free the buffers grown by a big request
+	void shrink();
+};
+
+//search buffers of the calling thread
+extern thread_local SearchScratch searchScratch;
+
+//append the searchTopK ann results nns/dis of one query to nodes in rank order,
+//at most topk of them unless keepAll. stop at the first missing id and, if
+//checkThresh, at the first distance beyond thresh
+void appendCandidates(const faiss::Index::idx_t *nns, const float *dis, int searchTopK,
+		size_t topk, bool keepAll, bool checkThresh, float thresh, std::vector<Node> *nodes);
+
+//fill results with nodes, reserved at once
+void fillResults(const std::vector<Node> &nodes,
+		::google::protobuf::RepeatedPtrField< ::faiss_server::HSearchResponse::Result> *results);
+
+#endif
@@ -0,0 +1,69 @@
+#ifndef TAG_STORE_H
+#define TAG_STORE_H
+
+#include <vector>
+#include <stdint.h>
+#include "ivfpq_scan.h"
+
+//max number of integer tags of a feature
+const int MaxTags = 8;
+
+/**
+ * TagStore keeps the integer tags of the features of a db in memory,
+ * one column per tag indexed by id, so that scans read one int per tag.
+ * tags not set read as 0. lmdb holds the persistent copy.
+ */
+class TagStore {
+	public:
+		//set the n tags of id, n <= MaxTags
+		void set(long id, const int32_t *tags, size_t n);
+
+		int32_t get(size_t tag, long id) const {
+			if (tag >= columns.size()) {
+				return 0;
+			}
+			const std::vector<int32_t> &col = columns[tag];
+			return (size_t)id < col.size() ? col[id] : 0;
+		}
+
+		void clear() {
+			columns.clear();
+		}
+
+		//number of tag columns
+		size_t size() const {
+			return columns.size();
+		}
+
+	private:
+		std::vector<std::vector<int32_t> > columns;
+};
+
+//condition on one tag
+struct TagFilter {
+	size_t tag;
+	//sorted, not empty: the tag is one of values
+	std::vector<int32_t> values;
+	//values empty: minValue <= tag <= maxValue
+	int32_t minValue;
+	int32_t maxValue;
+
+	TagFilter():tag(0),minValue(0),maxValue(0) {}
+
+	bool match(int32_t v) const;
+};
+
+//accept the ids whose tags match all filters
+class TagPredicate: public IdFilter {
+	public:
+		TagPredicate(const TagStore *store, const std::vector<TagFilter> *filters):
+			store(store), filters(filters) {}
+
+		bool accept(long id) const override;
+
+	private:
+		const TagStore *store;
+		const std::vector<TagFilter> *filters;
+};
+
+#endif
@@ -5,25 +5,88 @@
 #include <sys/stat.h>
 #include <unistd.h>
 #include <string>
+#include <vector>
 
 //全部配置
 struct GlobalConfig {
 	float EuclidThresh;
 	int NProbes;
+	int MaxNProbes;
+	int MaxTopK;
+	int TuneInterval;
+	int MaxRangeResults;
+	int RangeChunkSize;
+	int StreamWorkers;
+	int StreamQueue;
+	int StreamMaxInflight;
+	int BatchWindowUs;
+	int BatchMaxSize;
 	std::string Host;
 	int Port;
 	int PersistTime;
+	std::string Device;
+	int MaxBatchQueries;
+	//max queries * candidates of one HSearchBatch
+	int64_t MaxBatchCandidates;
+	//async server
+	bool AsyncServer;
+	int CqThreads;
+	int SearchWorkers;
+	int WriteWorkers;
+	int AdminWorkers;
+	int SearchQueue;
+	int WriteQueue;
+	int AdminQueue;
+	bool PinWorkers;
+	//HSearchMulti
+	int FanoutWorkers;
+	int FanoutQueue;
+	int MaxFanoutDbs;
+	//access log
+	std::string AccessLogPath;
+	int AccessLogRing;
+	double AccessLogSampleRate;
+	std::string AccessLogSample;
+	//result cache per db, 0 to disable
+	int ResultCacheMB;
+	//features per HSetBatch request and per HSetStream write
+	int MaxSetBatch;
+	//group commit of HSet, size 1 to disable
+	int SetGroupSize;
+	int SetGroupWaitUs;
+	//admission
+	std::string AdmissionLimits;
+	int WriteYieldMs;
+	//write-ahead log and async ingestion, WalDir empty to disable
+	std::string WalDir;
+	int WalSegmentMB;
+	bool WalSync;
+	int IngestBatch;
+	int IngestQueue;
+	int IngestWaitMs;
+	//lmdb env defaults of the dbs
+	int LmdbDurability;
+	int LmdbSyncMs;
+	bool LmdbWriteMap;
+	bool LmdbNoReadahead;
+	int LmdbMaxReaders;
 };
 
 static std::string SPersistIDKey		= "PERSIST_ID";
 static std::string SMaxIDKey			= "MAX_ID";
 static std::string SBlackListKey		= "BLACKLIST_KEY";
+static std::string STunedPointKey		= "TUNED_POINT";
+//tags of a feature were stored at STagPrefix + encoded id by older
+//versions, migrated to the IdTags database
+static std::string STagPrefix			= "TAG:";
 static std::string SGlobalDBName = ".global";
 static std::string SPrefix = "DB:";
 static std::string SDivide = "##";
 const uint64_t DefaultDBSize = 100000000;	
 const uint64_t MaxDBSize     = 10000000000;	
 const int FIXLEN = 10;
+//refine at most topk * MaxRefineFactor candidates
+const int MaxRefineFactor = 64;
 
 extern GlobalConfig globalConfig;
 
@@ -43,6 +106,14 @@ long decodeID(char *idstr);
 //calculate cosine distance between arr1 and arr2 subject to dimension d
 float cosine(const float *arr1, const float *arr2, int d);
 
+//calculate cosine distances between x and n vectors ys (size n * d),
+//use avx512/avx2 kernels if the cpu supports them
+void cosineBatch(const float *x, const float *ys, size_t n, int d, float *dis);
+
+//floats of the feature bytes of a request, read in place without a copy.
+//bytes not aligned for float are copied into buf first
+const float *floatView(const std::string &bytes, std::vector<float> *buf);
+
 enum ErrorCode {
 	/// Not an error; returned on success.
 	OK = 0,
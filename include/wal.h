@@ -0,0 +1,68 @@
+#ifndef WAL_H
+#define WAL_H
+
+#include <string>
+#include <vector>
+#include <functional>
+#include <stdint.h>
+
+/**
+ * Wal is the append-only write-ahead log of the features of one db, in
+ * segment files ${dir}/${firstID}.wal, firstID the id of their first record.
+ * A record is
+ *		len(uint32) crc32(uint32) | id(int64) d(uint32) ntags(uint32) feature(d floats) tags(ntags int32)
+ * crc32 covers the part after it, a torn or corrupt record ends the log.
+ * Ids of the records grow, segments are removed once the index persisted
+ * all their ids. Appends of ids not above the last logged one are refused,
+ * so the owner should replay before the first append.
+ * Not thread safe, the owner serializes the calls.
+ */
+class Wal {
+	public:
+		typedef std::function<int(long id, const float *feature, int d,
+				const int32_t *tags, size_t ntags)> ReplayFunc;
+
+		//segmentBytes: a segment is closed once bigger.
+		//sync: fdatasync every append
+		Wal(const std::string &dir, size_t segmentBytes, bool sync);
+		~Wal();
+
+		//create dir and list its segments, return 0 on success
+		int open();
+
+		//append the n features of dimension d with the ids from firstID, tags
+		//holds ntags tags per feature. return 0 once durable, -1 on failure
+		//or if firstID is not above the last logged id
+		int append(long firstID, const float *features, size_t n, int d,
+				const int32_t *tags, size_t ntags);
+
+		//call fn for the records with id > afterID in id order, stop at the
+		//first record fn fails. return the error of fn or 0
+		int replay(long afterID, ReplayFunc fn);
+
+		//remove the segments whose records all have id <= persistedID
+		void truncate(long persistedID);
+
+		//remove all segments and dir
+		void destroy();
+
+	private:
+		//start a segment for the records from firstID
+		int openSegment(long firstID);
+
+		std::string segmentPath(long firstID);
+
+		std::string dir;
+		size_t segmentBytes;
+		bool sync;
+		int fd;
+		size_t size;
+		//first ids of the segments, sorted
+		std::vector<long> segments;
+		//last id appended or seen by replay
+		long lastID;
+		//record buffer of append
+		std::vector<char> buf;
+};
+
+#endif
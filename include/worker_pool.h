@@ -0,0 +1,52 @@
+#ifndef WORKER_POOL_H
+#define WORKER_POOL_H
+
+#include <string>
+#include <vector>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <functional>
+#include <condition_variable>
+
+/**
+ * WorkerPool runs tasks on a fixed number of threads with a bounded queue.
+ * trySubmit never blocks: when the queue is full the task is rejected,
+ * the caller decides how to fail it (RESOURCE_EXHAUSTED for rpcs).
+ */
+class WorkerPool {
+	public:
+		typedef std::function<void()> Task;
+
+		//cpu < 0: no pinning, else worker i is pinned to cpu (cpu + i) % ncpus
+		WorkerPool(const std::string &name, int threads, int queueSize, int cpu = -1);
+		~WorkerPool();
+
+		//queue task, return false if the queue is full or the pool is stopped
+		bool trySubmit(Task task);
+
+		//stop accepting tasks, run the queued ones and join the workers
+		void stop();
+
+		//number of queued tasks
+		size_t pending();
+
+		int threads() const {
+			return (int)workers.size();
+		}
+
+	private:
+		void work(int i);
+
+		std::string name;
+		size_t maxQueue;
+		int cpu;
+
+		std::mutex mutex;
+		std::condition_variable condNotEmpty;
+		std::deque<Task> queue;
+		bool stopped;
+		std::vector<std::thread> workers;
+};
+
+#endif
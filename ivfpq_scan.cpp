@@ -0,0 +1,235 @@
+#include "ivfpq_scan.h"
+#include <algorithm>
+#include "faiss/Heap.h"
+#include "faiss/utils.h"
+
+typedef faiss::Index::idx_t idx_t;
+
+//distance tables of one query, computed per inverted list
+class ListScanner {
+	public:
+		ListScanner(const faiss::IndexIVFPQ *index, const float *x):
+			index(index), x(x), dis0(0), cur(NULL) {
+			const faiss::ProductQuantizer &pq = index->pq;
+			ip = index->metric_type == faiss::METRIC_INNER_PRODUCT;
+			precomputed = !ip && index->by_residual && index->use_precomputed_table == 1 &&
+				index->precomputed_table.size() == index->nlist * pq.M * pq.ksub;
+			if (ip || precomputed) {
+				//<x, y_R>, the same for all lists
+				queryTable.resize(pq.M * pq.ksub);
+				pq.compute_inner_prod_table(x, queryTable.data());
+				cur = queryTable.data();
+			}
+			if (!ip) {
+				table.resize(pq.M * pq.ksub);
+				cur = table.data();
+			}
+			if (!ip && !index->by_residual) {
+				pq.compute_distance_table(x, table.data());
+			} else if (!ip && !precomputed) {
+				residual.resize(index->d);
+			}
+		}
+
+		//prepare the tables of list key, coarseDis is the distance
+		//from x to the centroid of the list
+		void setList(idx_t key, float coarseDis) {
+			const faiss::ProductQuantizer &pq = index->pq;
+			size_t tsize = pq.M * pq.ksub;
+			if (ip) {
+				//<x, y_C + y_R> = <x, y_C> + <x, y_R>
+				dis0 = index->by_residual ? coarseDis : 0;
+			} else if (precomputed) {
+				//||x - y_C - y_R||^2 = ||x - y_C||^2 + ||y_R||^2 + 2 * <y_C, y_R> - 2 * <x, y_R>
+				//where the precomputed table holds ||y_R||^2 + 2 * <y_C, y_R>
+				dis0 = coarseDis;
+				const float *pre = index->precomputed_table.data() + key * tsize;
+				for (size_t i = 0; i < tsize; i ++) {
+					table[i] = pre[i] - 2 * queryTable[i];
+				}
+			} else if (index->by_residual) {
+				dis0 = 0;
+				index->quantizer->compute_residual(x, residual.data(), key);
+				pq.compute_distance_table(residual.data(), table.data());
+			}
+		}
+
+		//distance of the 8 bits pq code
+		float distance(const uint8_t *code) const {
+			const faiss::ProductQuantizer &pq = index->pq;
+			const float *t = cur;
+			float dis = dis0;
+			for (size_t m = 0; m < pq.M; m ++) {
+				dis += t[code[m]];
+				t += pq.ksub;
+			}
+			return dis;
+		}
+
+		bool innerProduct() const {
+			return ip;
+		}
+
+	private:
+		const faiss::IndexIVFPQ *index;
+		const float *x;
+		bool ip;
+		bool precomputed;
+		float dis0;
+		//table of the current list, size M * ksub
+		const float *cur;
+		std::vector<float> table;
+		std::vector<float> queryTable;
+		std::vector<float> residual;
+};
+
+bool ivfpqScannable(const faiss::IndexIVFPQ *index) {
+	return index->pq.nbits == 8 && index->code_size == index->pq.M;
+}
+
+//scan the probed lists of one query into a heap of k results.
+//skipped ids cost no distance computation
+static void scanQuery(const faiss::IndexIVFPQ *index, const float *x, idx_t k,
+		const ScanParams &params, const idx_t *keys, const float *coarseDis,
+		float *simi, idx_t *idxi) {
+	ListScanner scanner(index, x);
+	bool ip = scanner.innerProduct();
+	if (ip) {
+		faiss::minheap_heapify(k, simi, idxi);
+	} else {
+		faiss::maxheap_heapify(k, simi, idxi);
+	}
+	size_t codeSize = index->code_size;
+	for (int p = 0; p < params.nprobe; p ++) {
+		if (params.stop != NULL && params.stop->stop()) {
+			break;
+		}
+		idx_t key = keys[p];
+		if (key < 0 || key >= (idx_t)index->nlist) {
+			//not enough centroids for multiprobe
+			continue;
+		}
+		const std::vector<long> &ids = index->ids[key];
+		if (ids.size() < 1) {
+			continue;
+		}
+		const uint8_t *codes = index->codes[key].data();
+		scanner.setList(key, coarseDis[p]);
+		for (size_t j = 0; j < ids.size(); j ++) {
+			long id = ids[j];
+			if (params.skip(id)) {
+				continue;
+			}
+			float dis = scanner.distance(codes + j * codeSize);
+			if (ip) {
+				if (dis > simi[0]) {
+					faiss::minheap_pop(k, simi, idxi);
+					faiss::minheap_push(k, simi, idxi, dis, id);
+				}
+			} else if (dis < simi[0]) {
+				faiss::maxheap_pop(k, simi, idxi);
+				faiss::maxheap_push(k, simi, idxi, dis, id);
+			}
+		}
+	}
+	if (ip) {
+		faiss::minheap_reorder(k, simi, idxi);
+	} else {
+		faiss::maxheap_reorder(k, simi, idxi);
+	}
+}
+
+//scan the probed lists of one query, keep the best maxResults codes within
+//radius in a heap with the worst on top. truncated is set if one was dropped
+static void scanRange(const faiss::IndexIVFPQ *index, const float *x, float radius,
+		size_t maxResults, const ScanParams &params, const idx_t *keys, const float *coarseDis,
+		faiss::RangeSearchPartialResult::QueryResult &qres, bool *truncated) {
+	ListScanner scanner(index, x);
+	bool ip = scanner.innerProduct();
+	auto better = [ip](const std::pair<float, idx_t> &a, const std::pair<float, idx_t> &b) {
+		return ip ? a.first > b.first : a.first < b.first;
+	};
+	std::vector<std::pair<float, idx_t> > hits;
+	*truncated = false;
+	size_t codeSize = index->code_size;
+	for (int p = 0; p < params.nprobe; p ++) {
+		if (params.stop != NULL && params.stop->stop()) {
+			break;
+		}
+		idx_t key = keys[p];
+		if (key < 0 || key >= (idx_t)index->nlist) {
+			continue;
+		}
+		const std::vector<long> &ids = index->ids[key];
+		if (ids.size() < 1) {
+			continue;
+		}
+		const uint8_t *codes = index->codes[key].data();
+		scanner.setList(key, coarseDis[p]);
+		for (size_t j = 0; j < ids.size(); j ++) {
+			long id = ids[j];
+			if (params.skip(id)) {
+				continue;
+			}
+			float dis = scanner.distance(codes + j * codeSize);
+			if (ip ? dis <= radius : dis >= radius) {
+				continue;
+			}
+			std::pair<float, idx_t> hit(dis, id);
+			if (hits.size() < maxResults) {
+				hits.push_back(hit);
+				std::push_heap(hits.begin(), hits.end(), better);
+				continue;
+			}
+			*truncated = true;
+			if (hits.size() > 0 && better(hit, hits[0])) {
+				std::pop_heap(hits.begin(), hits.end(), better);
+				hits.back() = hit;
+				std::push_heap(hits.begin(), hits.end(), better);
+			}
+		}
+	}
+	for (size_t i = 0; i < hits.size(); i ++) {
+		qres.add(hits[i].first, hits[i].second);
+	}
+}
+
+void ivfpqRangeSearch(const faiss::IndexIVFPQ *index, idx_t n, const float *x,
+		float radius, size_t maxResults, const ScanParams &params,
+		faiss::RangeSearchResult *res, bool *truncated) {
+	int nprobe = params.nprobe;
+	std::vector<idx_t> keys(n * nprobe);
+	std::vector<float> coarseDis(n * nprobe);
+	index->quantizer->search(n, x, nprobe, coarseDis.data(), keys.data());
+
+	//every thread of the region must reach finalize
+#pragma omp parallel if (n > 1)
+	{
+		faiss::RangeSearchPartialResult pres(res);
+#pragma omp for
+		for (idx_t i = 0; i < n; i ++) {
+			faiss::RangeSearchPartialResult::QueryResult &qres = pres.new_result(i);
+			bool t = false;
+			scanRange(index, x + i * index->d, radius, maxResults, params, keys.data() + i * nprobe,
+					coarseDis.data() + i * nprobe, qres, &t);
+			if (truncated != NULL) {
+				truncated[i] = t;
+			}
+		}
+		pres.finalize();
+	}
+}
+
+void ivfpqSearch(const faiss::IndexIVFPQ *index, idx_t n, const float *x,
+		idx_t k, const ScanParams &params, float *dis, idx_t *nns) {
+	int nprobe = params.nprobe;
+	std::vector<idx_t> keys(n * nprobe);
+	std::vector<float> coarseDis(n * nprobe);
+	index->quantizer->search(n, x, nprobe, coarseDis.data(), keys.data());
+
+#pragma omp parallel for if (n > 1)
+	for (idx_t i = 0; i < n; i ++) {
+		scanQuery(index, x + i * index->d, k, params, keys.data() + i * nprobe,
+				coarseDis.data() + i * nprobe, dis + i * k, nns + i * k);
+	}
+}
@@ -2,6 +2,8 @@
 #include <stdio.h>
 #include <grpc++/grpc++.h>
 #include "faiss_logic.h"
+#include "async_server.h"
+#include "access_log.h"
 using grpc::Server;
 using grpc::ServerBuilder;
 using grpc::ServerContext;
@@ -12,6 +14,56 @@ DEFINE_int32(port, 3838, "the server port");
 DEFINE_int32(persist_time, 10, "persist time");
 DEFINE_double(euclid_thresh, 30.0f, "euclid thresh hold");
 DEFINE_int32(nprobes, 32, "number of probes");
+DEFINE_int32(max_nprobes, 256, "max number of probes a search request may ask for");
+DEFINE_int32(max_top_k, 1000, "max top_k of a search request");
+DEFINE_int32(max_range_results, 100000, "max number of results of a HRangeSearch request");
+DEFINE_int32(range_chunk_size, 1000, "number of results per HRangeSearch stream message");
+DEFINE_int32(stream_workers, 16, "number of threads searching the queries of all HSearchStream streams");
+DEFINE_int32(stream_queue, 1024, "max number of queued HSearchStream queries, more are searched by the stream thread");
+DEFINE_int32(stream_max_inflight, 64, "max number of queries of one HSearchStream being searched");
+DEFINE_int32(tune_interval, 600, "interval in seconds to check the dbs with target_recall for tuning, 0 to disable");
+DEFINE_int32(search_batch_window_us, 0, "max time in microseconds to wait for concurrent HSearch queries to batch with, 0 to disable batching");
+DEFINE_int32(search_batch_max_size, 64, "max number of concurrent HSearch queries in one batch");
+DEFINE_int32(max_batch_queries, 10000, "max number of queries in one HSearchBatch request");
+DEFINE_int64(max_batch_candidates, 4000000, "max number of queries * index candidates (top_k * refine_factor) of one HSearchBatch request, about 12 bytes each");
+DEFINE_int32(set_group_size, 1, "max number of concurrent HSet features of a db committed in one index add and lmdb transaction, 1 to disable group commit");
+DEFINE_int32(set_group_wait_us, 200, "max time in microseconds the group commit writer waits for more HSet features");
+DEFINE_string(wal_dir, "", "write-ahead log dir, adds return once in the log and are indexed asynchronously, empty to disable");
+DEFINE_int32(wal_segment_mb, 64, "size in MB of a write-ahead log segment");
+DEFINE_bool(wal_sync, true, "fdatasync the write-ahead log on every append");
+DEFINE_int32(ingest_batch, 4096, "max number of features the ingester stores and indexes at once");
+DEFINE_int32(ingest_queue, 100000, "max number of features of a db waiting for ingestion, adds wait beyond");
+DEFINE_int32(ingest_wait_ms, 1000, "max time in ms a search with min_id or a delete waits for ingestion");
+DEFINE_string(lmdb_durability, "sync", "durability of the db lmdb commits without a durability of their own: sync, nometasync or nosync");
+DEFINE_int32(lmdb_sync_ms, 1000, "interval in ms to sync the nometasync and nosync db lmdbs, 0 to sync only when the index is persisted");
+DEFINE_bool(lmdb_writemap, false, "open all db lmdbs with MDB_WRITEMAP");
+DEFINE_bool(lmdb_nordahead, false, "open all db lmdbs with MDB_NORDAHEAD, for random reads of dbs larger than memory");
+DEFINE_int32(lmdb_max_readers, 0, "reader slots of each lmdb, 0 to derive from the worker pools plus 126 for the sync server threads");
+DEFINE_int32(max_set_batch, 10000, "max number of features in one HSetBatch request, HSetStream writes its features in batches of this size");
+DEFINE_int32(fanout_workers, 16, "number of threads searching the dbs of HSearchMulti requests");
+DEFINE_int32(fanout_queue, 1024, "max number of queued db searches of HSearchMulti, more are searched by the request thread");
+DEFINE_int32(max_fanout_dbs, 64, "max number of dbs in one HSearchMulti request");
+DEFINE_bool(async_server, false, "serve the unary rpcs on completion queues with the search/write/admin worker pools");
+DEFINE_int32(cq_threads, 2, "number of completion queues of the async server, one polling thread each");
+DEFINE_int32(search_workers, 8, "number of async server threads for HSearch, HSearchBatch, HSearchMulti and HGet");
+DEFINE_int32(write_workers, 2, "number of async server threads for HSet, HSetBatch and HDel");
+DEFINE_int32(admin_workers, 1, "number of async server threads for Ping, DbNew, DbDel and DbList");
+DEFINE_int32(search_queue, 256, "max number of queued search rpcs, more are rejected with RESOURCE_EXHAUSTED");
+DEFINE_int32(write_queue, 128, "max number of queued write rpcs, more are rejected with RESOURCE_EXHAUSTED");
+DEFINE_int32(admin_queue, 32, "max number of queued admin rpcs, more are rejected with RESOURCE_EXHAUSTED");
+DEFINE_bool(pin_workers, false, "pin the async server worker threads to cpus, pools get disjoint cpus");
+DEFINE_string(access_log, "", "access log file of all rpcs but Ping, written by a background thread. empty to log to glog");
+DEFINE_int32(access_log_ring, 8192, "max number of access records waiting for the writer, more are dropped");
+DEFINE_double(access_log_sample_rate, 1.0, "fraction of the access records kept, errors are always kept");
+DEFINE_string(access_log_sample, "", "sampling rates per cmd overriding --access_log_sample_rate, e.g. HSearch=0.01,HSet=1");
+DEFINE_int32(result_cache_mb, 0, "memory in MB of the search result cache of each db, 0 to disable");
+DEFINE_string(admission_limits, "", "limits per work class as class=concurrency/rate/queue, 0 for unlimited, e.g. insert=2/1000/256,bulk_search=4/0/64. classes: search, bulk_search, insert, persist, admin");
+DEFINE_int32(write_yield_ms, 0, "max time in ms inserts and index persistence wait while interactive searches run, 0 to never wait");
+#ifdef FAISS_SERVER_GPU
+DEFINE_string(device, "gpu", "index device of new dbs, cpu or gpu");
+#else
+DEFINE_string(device, "cpu", "index device of new dbs, only cpu is supported by this build");
+#endif
 
 GlobalConfig globalConfig;
 
@@ -22,20 +74,104 @@ void RunServer()
 	globalConfig.PersistTime = FLAGS_persist_time;
 	globalConfig.EuclidThresh = FLAGS_euclid_thresh;
 	globalConfig.NProbes = FLAGS_nprobes;
+	globalConfig.MaxNProbes = FLAGS_max_nprobes;
+	globalConfig.MaxTopK = FLAGS_max_top_k;
+	globalConfig.TuneInterval = FLAGS_tune_interval;
+	globalConfig.MaxRangeResults = FLAGS_max_range_results;
+	globalConfig.RangeChunkSize = FLAGS_range_chunk_size;
+	globalConfig.StreamWorkers = FLAGS_stream_workers;
+	globalConfig.StreamQueue = FLAGS_stream_queue;
+	globalConfig.StreamMaxInflight = FLAGS_stream_max_inflight;
+	globalConfig.BatchWindowUs = FLAGS_search_batch_window_us;
+	globalConfig.BatchMaxSize = FLAGS_search_batch_max_size;
+	globalConfig.Device = FLAGS_device;
+	globalConfig.MaxBatchQueries = FLAGS_max_batch_queries;
+	globalConfig.MaxBatchCandidates = FLAGS_max_batch_candidates;
+	globalConfig.MaxSetBatch = FLAGS_max_set_batch;
+	globalConfig.SetGroupSize = FLAGS_set_group_size;
+	globalConfig.SetGroupWaitUs = FLAGS_set_group_wait_us;
+	globalConfig.WalDir = FLAGS_wal_dir;
+	globalConfig.WalSegmentMB = FLAGS_wal_segment_mb;
+	globalConfig.WalSync = FLAGS_wal_sync;
+	globalConfig.IngestBatch = FLAGS_ingest_batch;
+	globalConfig.IngestQueue = FLAGS_ingest_queue;
+	globalConfig.IngestWaitMs = FLAGS_ingest_wait_ms;
+	globalConfig.LmdbSyncMs = FLAGS_lmdb_sync_ms;
+	globalConfig.LmdbWriteMap = FLAGS_lmdb_writemap;
+	globalConfig.LmdbNoReadahead = FLAGS_lmdb_nordahead;
+	globalConfig.LmdbMaxReaders = FLAGS_lmdb_max_readers;
+	globalConfig.FanoutWorkers = FLAGS_fanout_workers;
+	globalConfig.FanoutQueue = FLAGS_fanout_queue;
+	globalConfig.MaxFanoutDbs = FLAGS_max_fanout_dbs;
+	globalConfig.AsyncServer = FLAGS_async_server;
+	globalConfig.CqThreads = FLAGS_cq_threads;
+	globalConfig.SearchWorkers = FLAGS_search_workers;
+	globalConfig.WriteWorkers = FLAGS_write_workers;
+	globalConfig.AdminWorkers = FLAGS_admin_workers;
+	globalConfig.SearchQueue = FLAGS_search_queue;
+	globalConfig.WriteQueue = FLAGS_write_queue;
+	globalConfig.AdminQueue = FLAGS_admin_queue;
+	globalConfig.PinWorkers = FLAGS_pin_workers;
+	globalConfig.AccessLogPath = FLAGS_access_log;
+	globalConfig.AccessLogRing = FLAGS_access_log_ring;
+	globalConfig.AccessLogSampleRate = FLAGS_access_log_sample_rate;
+	globalConfig.AccessLogSample = FLAGS_access_log_sample;
+	globalConfig.ResultCacheMB = FLAGS_result_cache_mb;
+	globalConfig.AdmissionLimits = FLAGS_admission_limits;
+	globalConfig.WriteYieldMs = FLAGS_write_yield_ms;
+	if (!validDevice(globalConfig.Device)) {
+		LOG(FATAL) << "index device not supported:" << globalConfig.Device;
+		exit(-1);
+	}
+	if (FLAGS_lmdb_durability == "sync") {
+		globalConfig.LmdbDurability = LmdbSync;
+	} else if (FLAGS_lmdb_durability == "nometasync") {
+		globalConfig.LmdbDurability = LmdbNoMetaSync;
+	} else if (FLAGS_lmdb_durability == "nosync") {
+		globalConfig.LmdbDurability = LmdbNoSync;
+	} else {
+		LOG(FATAL) << "lmdb durability not supported:" << FLAGS_lmdb_durability;
+		exit(-1);
+	}
+	if (AccessLog::init(globalConfig.AccessLogPath, globalConfig.AccessLogRing,
+				globalConfig.AccessLogSampleRate, globalConfig.AccessLogSample) != 0) {
+		LOG(FATAL) << "init access log failed";
+		exit(-1);
+	}
 
 	std::string srv = globalConfig.Host + ":" + std::to_string(globalConfig.Port);
 	std::string server_address(srv);
 	FaissServiceImpl service;
 	ServerBuilder builder;
 	builder.AddListeningPort(server_address, grpc::InsecureServerCredentials());
-	builder.RegisterService(&service);
+	std::unique_ptr<AsyncServer> async;
+	if (globalConfig.AsyncServer) {
+		async.reset(new AsyncServer(&service));
+		async->registerTo(&builder);
+	} else {
+		builder.RegisterService(&service);
+	}
 	std::unique_ptr<Server> server(builder.BuildAndStart());
-	LOG(INFO)<< "Server start on " << server_address << std::endl;
+	if (async) {
+		async->start();
+	}
+	LOG(INFO)<< "Server start on " << server_address << " async:" << globalConfig.AsyncServer << std::endl;
 	
 	//persist thread
 	std::thread th(FaissServiceImpl::PersistIndexPeriod, &service, globalConfig.PersistTime);
+	//tune thread
+	if (globalConfig.TuneInterval > 0) {
+		std::thread tuneTh(FaissServiceImpl::TuneDbsPeriod, &service, globalConfig.TuneInterval);
+		tuneTh.detach();
+	}
+	//lmdb sync thread
+	if (globalConfig.LmdbSyncMs > 0) {
+		std::thread syncTh(FaissServiceImpl::SyncLmdbPeriod, &service, globalConfig.LmdbSyncMs);
+		syncTh.detach();
+	}
 	th.join();
 	server->Wait();
+	AccessLog::stop();
 }
 
 int main(int argc, char **argv)
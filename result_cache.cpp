@@ -0,0 +1,72 @@
+#include "result_cache.h"
+
+ResultCache::ResultCache(size_t maxBytes):maxBytes(maxBytes),bytes(0),
+	hits(0),misses(0),evictions(0) {}
+
+size_t ResultCache::entryBytes(const Entry &e) {
+	//the key is held by the entry and by the map, plus the node overheads
+	return 2 * e.key.size() + e.hits.capacity() * sizeof(CachedHit) + sizeof(Entry) + 64;
+}
+
+void ResultCache::erase(std::unordered_map<std::string, EntryList::iterator>::iterator it) {
+	bytes -= entryBytes(*(it->second));
+	lru.erase(it->second);
+	entries.erase(it);
+}
+
+bool ResultCache::get(const std::string &key, uint64_t epoch, std::vector<CachedHit> *out) {
+	std::lock_guard<std::mutex> guard(mutex);
+	auto it = entries.find(key);
+	if (it == entries.end()) {
+		misses ++;
+		return false;
+	}
+	if (it->second->epoch != epoch) {
+		//written since cached
+		erase(it);
+		misses ++;
+		return false;
+	}
+	lru.splice(lru.begin(), lru, it->second);
+	*out = it->second->hits;
+	hits ++;
+	return true;
+}
+
+void ResultCache::put(const std::string &key, uint64_t epoch, const std::vector<CachedHit> &results) {
+	std::lock_guard<std::mutex> guard(mutex);
+	auto it = entries.find(key);
+	if (it != entries.end()) {
+		//a newer search of the same query wins
+		if (it->second->epoch > epoch) {
+			return;
+		}
+		erase(it);
+	}
+	Entry e;
+	e.key = key;
+	e.epoch = epoch;
+	e.hits = results;
+	size_t size = entryBytes(e);
+	if (size > maxBytes) {
+		return;
+	}
+	while (bytes + size > maxBytes && !lru.empty()) {
+		erase(entries.find(lru.back().key));
+		evictions ++;
+	}
+	lru.push_front(std::move(e));
+	entries[key] = lru.begin();
+	bytes += size;
+}
+
+ResultCache::Stats ResultCache::stats() {
+	std::lock_guard<std::mutex> guard(mutex);
+	Stats s;
+	s.hits = hits;
+	s.misses = misses;
+	s.evictions = evictions;
+	s.bytes = bytes;
+	s.entries = entries.size();
+	return s;
+}
@@ -0,0 +1,97 @@
+#include "search_batcher.h"
+#include <string.h>
+#include <chrono>
+#include <algorithm>
+#include <glog/logging.h>
+
+SearchBatcher::SearchBatcher(SearchFunc func, int windowUs, int maxBatch):
+	func(func), windowUs(windowUs), maxBatch(maxBatch > 0 ? maxBatch : 1) {
+}
+
+int SearchBatcher::searchAlone(const float *x, idx_t k, int nprobe, float *dis, idx_t *nns) {
+	try {
+		func(1, x, k, nprobe, dis, nns);
+	} catch(...) {
+		LOG(WARNING) << "search failed";
+		return -1;
+	}
+	return 0;
+}
+
+int SearchBatcher::search(const float *x, int d, idx_t k, int nprobe, float *dis, idx_t *nns) {
+	if (!enabled()) {
+		//batching disabled
+		return searchAlone(x, k, nprobe, dis, nns);
+	}
+
+	std::shared_ptr<Batch> batch;
+	{
+		std::unique_lock<std::mutex> ulk(mutex);
+		bool leader = false;
+		if (!open) {
+			open = std::make_shared<Batch>(nprobe);
+			leader = true;
+		} else if (open->nprobe != nprobe) {
+			//the open batch searches with other probes
+			ulk.unlock();
+			return searchAlone(x, k, nprobe, dis, nns);
+		}
+		batch = open;
+		Query query = {x, k, dis, nns};
+		batch->queries.push_back(query);
+		batch->k = std::max(batch->k, k);
+		if (batch->queries.size() >= maxBatch) {
+			//batch is full, close it and wake up the leader
+			open.reset();
+			condFull.notify_all();
+		}
+
+		if (!leader) {
+			condDone.wait(ulk, [&]()->bool {return batch->done; });
+			return batch->rc;
+		}
+
+		auto deadline = std::chrono::steady_clock::now() + std::chrono::microseconds(windowUs);
+		condFull.wait_until(ulk, deadline, [&]()->bool {return open != batch; });
+		if (open == batch) {
+			open.reset();
+		}
+	}
+
+	//batch is closed, no one else touches it until done
+	run(batch.get(), d);
+	{
+		std::unique_lock<std::mutex> ulk(mutex);
+		batch->done = true;
+	}
+	condDone.notify_all();
+	return batch->rc;
+}
+
+void SearchBatcher::run(Batch *batch, int d) {
+	size_t n = batch->queries.size();
+	idx_t k = batch->k;
+
+	std::vector<float> xs(n * d);
+	std::vector<float> dis(n * k);
+	std::vector<idx_t> nns(n * k);
+	for (size_t i = 0; i < n; i ++) {
+		memcpy(xs.data() + i * d, batch->queries[i].x, sizeof(float) * d);
+	}
+
+	try {
+		func(n, xs.data(), k, batch->nprobe, dis.data(), nns.data());
+	} catch(...) {
+		LOG(WARNING) << "batch search failed, nq:" << n;
+		batch->rc = -1;
+		return;
+	}
+	VLOG(50) << "batch search nq:" << n << " k:" << k;
+
+	//results are sorted, the first q.k of the row are the top q.k
+	for (size_t i = 0; i < n; i ++) {
+		Query &q = batch->queries[i];
+		memcpy(q.dis, dis.data() + i * k, sizeof(float) * q.k);
+		memcpy(q.nns, nns.data() + i * k, sizeof(idx_t) * q.k);
+	}
+}
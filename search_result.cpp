@@ -0,0 +1,46 @@
+#include "search_result.h"
+
+thread_local SearchScratch searchScratch;
+
+void SearchScratch::shrink() {
+	const size_t maxFloats = 1 << 20;
+	if (queries.capacity() > maxFloats) {
+		std::vector<float>().swap(queries);
+	}
+	if (nns.capacity() > maxFloats) {
+		std::vector<faiss::Index::idx_t>().swap(nns);
+		std::vector<float>().swap(dis);
+	}
+	if (nodes.capacity() > maxFloats) {
+		std::vector<Node>().swap(nodes);
+	}
+}
+
+void appendCandidates(const faiss::Index::idx_t *nns, const float *dis, int searchTopK,
+		size_t topk, bool keepAll, bool checkThresh, float thresh, std::vector<Node> *nodes) {
+	for (int j = 0; j < searchTopK; j++) {
+		if (!keepAll && nodes->size() >= topk) {
+			break;
+		}
+		if (nns[j] < 0) {
+			break;
+		}
+		if (checkThresh && dis[j] > thresh) {
+			break;
+		}
+		Node node;
+		node.score = dis[j];
+		node.id = nns[j];
+		nodes->push_back(node);
+	}
+}
+
+void fillResults(const std::vector<Node> &nodes,
+		::google::protobuf::RepeatedPtrField< ::faiss_server::HSearchResponse::Result> *results) {
+	results->Reserve(nodes.size());
+	for (auto it = nodes.begin(); it != nodes.end(); ++it) {
+		auto rs = results->Add();
+		rs->set_score(it->score);
+		rs->set_id(it->id);
+	}
+}
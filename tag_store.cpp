@@ -0,0 +1,36 @@
+#include "tag_store.h"
+#include <algorithm>
+
+void TagStore::set(long id, const int32_t *tags, size_t n) {
+	if (id < 0) {
+		return;
+	}
+	n = std::min(n, (size_t)MaxTags);
+	if (columns.size() < n) {
+		columns.resize(n);
+	}
+	for (size_t i = 0; i < n; i ++) {
+		std::vector<int32_t> &col = columns[i];
+		if (col.size() <= (size_t)id) {
+			col.resize(id + 1, 0);
+		}
+		col[id] = tags[i];
+	}
+}
+
+bool TagFilter::match(int32_t v) const {
+	if (values.empty()) {
+		return v >= minValue && v <= maxValue;
+	}
+	return std::binary_search(values.begin(), values.end(), v);
+}
+
+bool TagPredicate::accept(long id) const {
+	for (size_t i = 0; i < filters->size(); i ++) {
+		const TagFilter &f = (*filters)[i];
+		if (!f.match(store->get(f.tag, id))) {
+			return false;
+		}
+	}
+	return true;
+}
@@ -1,6 +1,11 @@
 #include "utils.h"
 #include <string.h>
+#include <stdint.h>
 #include <math.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define COSINE_SIMD
+#endif
 bool checkPathExists(std::string &path) {
 	if (path.length() < 1) {
 		return false;
@@ -34,7 +39,12 @@ long decodeID(char *buf) {
 	if (buf == NULL || strlen(buf) != FIXLEN) {
 		return -1;
 	}
-	return atoi(buf);
+	for (int i = 0; i < FIXLEN; i++) {
+		if (buf[i] > '9' || buf[i] < '0') {
+			return -1;
+		}
+	}
+	return atol(buf);
 }
 
 float cosine(const float *arr1, const float *arr2, int d) {
@@ -48,3 +58,102 @@ float cosine(const float *arr1, const float *arr2, int d) {
 
 	return px / sqrt(p1*p2);
 }
+
+
+//dot product of x and y, and squared norm of y
+typedef void (*DotNormFunc)(const float *x, const float *y, int d, float *dot, float *norm);
+
+static void dotNormScalar(const float *x, const float *y, int d, float *dot, float *norm) {
+	float px = 0, py = 0;
+	for (int i = 0; i < d; i++) {
+		px += x[i]*y[i];
+		py += y[i]*y[i];
+	}
+	*dot = px;
+	*norm = py;
+}
+
+#ifdef COSINE_SIMD
+__attribute__((target("avx2,fma")))
+static void dotNormAvx2(const float *x, const float *y, int d, float *dot, float *norm) {
+	__m256 px = _mm256_setzero_ps();
+	__m256 py = _mm256_setzero_ps();
+	int i = 0;
+	for (; i + 8 <= d; i += 8) {
+		__m256 vx = _mm256_loadu_ps(x + i);
+		__m256 vy = _mm256_loadu_ps(y + i);
+		px = _mm256_fmadd_ps(vx, vy, px);
+		py = _mm256_fmadd_ps(vy, vy, py);
+	}
+	float bx[8], by[8];
+	_mm256_storeu_ps(bx, px);
+	_mm256_storeu_ps(by, py);
+	float sx = 0, sy = 0;
+	for (int j = 0; j < 8; j++) {
+		sx += bx[j];
+		sy += by[j];
+	}
+	for (; i < d; i++) {
+		sx += x[i]*y[i];
+		sy += y[i]*y[i];
+	}
+	*dot = sx;
+	*norm = sy;
+}
+
+__attribute__((target("avx512f")))
+static void dotNormAvx512(const float *x, const float *y, int d, float *dot, float *norm) {
+	__m512 px = _mm512_setzero_ps();
+	__m512 py = _mm512_setzero_ps();
+	int i = 0;
+	for (; i + 16 <= d; i += 16) {
+		__m512 vx = _mm512_loadu_ps(x + i);
+		__m512 vy = _mm512_loadu_ps(y + i);
+		px = _mm512_fmadd_ps(vx, vy, px);
+		py = _mm512_fmadd_ps(vy, vy, py);
+	}
+	float sx = _mm512_reduce_add_ps(px);
+	float sy = _mm512_reduce_add_ps(py);
+	for (; i < d; i++) {
+		sx += x[i]*y[i];
+		sy += y[i]*y[i];
+	}
+	*dot = sx;
+	*norm = sy;
+}
+#endif
+
+//pick the kernel once by the features of the running cpu
+static DotNormFunc selectDotNorm() {
+#ifdef COSINE_SIMD
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx512f")) {
+		return dotNormAvx512;
+	}
+	if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+		return dotNormAvx2;
+	}
+#endif
+	return dotNormScalar;
+}
+
+void cosineBatch(const float *x, const float *ys, size_t n, int d, float *dis) {
+	static DotNormFunc dotNorm = selectDotNorm();
+	float dot = 0, px = 0;
+	dotNorm(x, x, d, &dot, &px);
+	for (size_t i = 0; i < n; i++) {
+		float py = 0;
+		dotNorm(x, ys + i * d, d, &dot, &py);
+		dis[i] = dot / sqrt(px*py);
+	}
+}
+
+const float *floatView(const std::string &bytes, std::vector<float> *buf) {
+	const char *data = bytes.data();
+	if ((uintptr_t)data % sizeof(float) == 0) {
+		return (const float*)data;
+	}
+	buf->resize(bytes.length() / sizeof(float));
+	memcpy(buf->data(), data, buf->size() * sizeof(float));
+	return buf->data();
+}
@@ -0,0 +1,251 @@
+#include "wal.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <dirent.h>
+#include <unistd.h>
+#include <algorithm>
+#include <glog/logging.h>
+#include "utils.h"
+
+//len and crc32 of a record
+static const size_t HeaderBytes = 8;
+//id, d and ntags
+static const size_t FixedBytes = 16;
+//records bigger than this are corrupt
+static const uint32_t MaxRecordBytes = 1 << 26;
+
+static uint32_t crcTable[256];
+
+static void initCrcTable() {
+	for (uint32_t i = 0; i < 256; i ++) {
+		uint32_t c = i;
+		for (int k = 0; k < 8; k ++) {
+			c = (c & 1) ? 0xEDB88320 ^ (c >> 1) : c >> 1;
+		}
+		crcTable[i] = c;
+	}
+}
+
+//crc32 of zlib
+static uint32_t crc32(const char *data, size_t len) {
+	static bool inited = (initCrcTable(), true);
+	(void)inited;
+	uint32_t c = 0xFFFFFFFF;
+	for (size_t i = 0; i < len; i ++) {
+		c = crcTable[(c ^ (uint8_t)data[i]) & 0xFF] ^ (c >> 8);
+	}
+	return c ^ 0xFFFFFFFF;
+}
+
+Wal::Wal(const std::string &dir, size_t segmentBytes, bool sync):
+	dir(dir),segmentBytes(segmentBytes),sync(sync),fd(-1),size(0),lastID(0) {}
+
+Wal::~Wal() {
+	if (fd >= 0) {
+		close(fd);
+	}
+}
+
+std::string Wal::segmentPath(long firstID) {
+	char name[32] = {'\0'};
+	snprintf(name, sizeof(name), "/%020ld.wal", firstID);
+	return dir + name;
+}
+
+int Wal::open() {
+	//mkdir -p
+	for (size_t pos = dir.find('/', 1); ; pos = dir.find('/', pos + 1)) {
+		std::string path = dir.substr(0, pos);
+		if (!mkFolder(path)) {
+			LOG(WARNING) << "create wal dir failed:" << path;
+			return -1;
+		}
+		if (pos == std::string::npos) {
+			break;
+		}
+	}
+	DIR *d = opendir(dir.c_str());
+	if (NULL == d) {
+		LOG(WARNING) << "open wal dir failed:" << dir;
+		return -1;
+	}
+	segments.clear();
+	struct dirent *ent;
+	while ((ent = readdir(d)) != NULL) {
+		const char *name = ent->d_name;
+		size_t len = strlen(name);
+		if (len < 5 || strcmp(name + len - 4, ".wal") != 0) {
+			continue;
+		}
+		segments.push_back(atol(name));
+	}
+	closedir(d);
+	std::sort(segments.begin(), segments.end());
+	//ids below the last segment were logged
+	if (!segments.empty()) {
+		lastID = std::max(lastID, segments.back() - 1);
+	}
+	return 0;
+}
+
+int Wal::openSegment(long firstID) {
+	if (fd >= 0) {
+		close(fd);
+		fd = -1;
+	}
+	std::string path = segmentPath(firstID);
+	//firstID is above every logged id, a segment of the same name
+	//only holds the torn records of a failed append
+	fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_APPEND, 0644);
+	if (fd < 0) {
+		LOG(WARNING) << "open wal segment failed:" << path << " errno:" << errno;
+		return -1;
+	}
+	if (segments.empty() || segments.back() != firstID) {
+		segments.push_back(firstID);
+	}
+	size = 0;
+	return 0;
+}
+
+int Wal::append(long firstID, const float *features, size_t n, int d,
+		const int32_t *tags, size_t ntags) {
+	if (firstID <= lastID) {
+		LOG(WARNING) << "wal append of id " << firstID << " not above the logged id " << lastID;
+		return -1;
+	}
+	if (fd < 0 || size >= segmentBytes) {
+		if (openSegment(firstID) != 0) {
+			return -1;
+		}
+	}
+	size_t payload = FixedBytes + sizeof(float) * d + sizeof(int32_t) * ntags;
+	buf.resize(n * (HeaderBytes + payload));
+	char *p = buf.data();
+	for (size_t i = 0; i < n; i ++) {
+		char *body = p + HeaderBytes;
+		int64_t id = firstID + i;
+		uint32_t dim = d, nt = ntags;
+		memcpy(body, &id, 8);
+		memcpy(body + 8, &dim, 4);
+		memcpy(body + 12, &nt, 4);
+		memcpy(body + FixedBytes, features + i * d, sizeof(float) * d);
+		if (ntags > 0) {
+			memcpy(body + FixedBytes + sizeof(float) * d, tags + i * ntags, sizeof(int32_t) * ntags);
+		}
+		uint32_t len = payload;
+		uint32_t crc = crc32(body, payload);
+		memcpy(p, &len, 4);
+		memcpy(p + 4, &crc, 4);
+		p += HeaderBytes + payload;
+	}
+	size_t written = 0;
+	while (written < buf.size()) {
+		ssize_t w = write(fd, buf.data() + written, buf.size() - written);
+		if (w < 0 && errno == EINTR) {
+			continue;
+		}
+		if (w <= 0) {
+			LOG(WARNING) << "write wal failed:" << segmentPath(segments.back()) << " errno:" << errno;
+			//the torn tail ends this segment, later records go to a new one
+			close(fd);
+			fd = -1;
+			return -1;
+		}
+		written += w;
+	}
+	if (sync && fdatasync(fd) != 0) {
+		LOG(WARNING) << "sync wal failed:" << segmentPath(segments.back()) << " errno:" << errno;
+		close(fd);
+		fd = -1;
+		return -1;
+	}
+	size += written;
+	lastID = firstID + n - 1;
+	return 0;
+}
+
+int Wal::replay(long afterID, ReplayFunc fn) {
+	std::vector<char> record;
+	for (size_t s = 0; s < segments.size(); s ++) {
+		if (s + 1 < segments.size() && segments[s + 1] - 1 <= afterID) {
+			continue;
+		}
+		std::string path = segmentPath(segments[s]);
+		FILE *f = fopen(path.c_str(), "rb");
+		if (NULL == f) {
+			LOG(WARNING) << "open wal segment failed:" << path;
+			return -1;
+		}
+		size_t records = 0;
+		while (true) {
+			uint32_t header[2];
+			if (fread(header, 1, HeaderBytes, f) != HeaderBytes) {
+				break;
+			}
+			uint32_t len = header[0];
+			if (len < FixedBytes || len > MaxRecordBytes) {
+				LOG(WARNING) << "corrupt wal record:" << path << " records:" << records;
+				break;
+			}
+			record.resize(len);
+			if (fread(record.data(), 1, len, f) != len || crc32(record.data(), len) != header[1]) {
+				LOG(WARNING) << "torn wal record:" << path << " records:" << records;
+				break;
+			}
+			int64_t id;
+			uint32_t dim, nt;
+			memcpy(&id, record.data(), 8);
+			memcpy(&dim, record.data() + 8, 4);
+			memcpy(&nt, record.data() + 12, 4);
+			if (FixedBytes + sizeof(float) * dim + sizeof(int32_t) * nt != len) {
+				LOG(WARNING) << "corrupt wal record:" << path << " records:" << records;
+				break;
+			}
+			records ++;
+			lastID = std::max(lastID, (long)id);
+			if (id <= afterID) {
+				continue;
+			}
+			//the payload is 8 bytes aligned in record
+			const float *feature = (const float*)(record.data() + FixedBytes);
+			const int32_t *tags = (const int32_t*)(record.data() + FixedBytes + sizeof(float) * dim);
+			int rc = fn(id, feature, dim, tags, nt);
+			if (rc != 0) {
+				fclose(f);
+				return rc;
+			}
+		}
+		fclose(f);
+	}
+	return 0;
+}
+
+void Wal::truncate(long persistedID) {
+	//the last segment stays open for appends
+	size_t removed = 0;
+	while (removed + 1 < segments.size() && segments[removed + 1] - 1 <= persistedID) {
+		std::string path = segmentPath(segments[removed]);
+		if (unlink(path.c_str()) != 0) {
+			LOG(WARNING) << "remove wal segment failed:" << path;
+			break;
+		}
+		removed ++;
+	}
+	segments.erase(segments.begin(), segments.begin() + removed);
+}
+
+void Wal::destroy() {
+	if (fd >= 0) {
+		close(fd);
+		fd = -1;
+	}
+	for (size_t s = 0; s < segments.size(); s ++) {
+		unlink(segmentPath(segments[s]).c_str());
+	}
+	segments.clear();
+	rmdir(dir.c_str());
+}
@@ -0,0 +1,83 @@
+#include "worker_pool.h"
+#include <pthread.h>
+#include <sched.h>
+#include <glog/logging.h>
+
+WorkerPool::WorkerPool(const std::string &name, int threads, int queueSize, int cpu):
+	name(name), maxQueue(queueSize > 0 ? queueSize : 1), cpu(cpu), stopped(false) {
+	if (threads < 1) {
+		threads = 1;
+	}
+	for (int i = 0; i < threads; i ++) {
+		workers.push_back(std::thread(&WorkerPool::work, this, i));
+	}
+	LOG(INFO) << "worker pool:" << name << " threads:" << threads
+		<< " queue:" << maxQueue << " cpu:" << cpu;
+}
+
+WorkerPool::~WorkerPool() {
+	stop();
+}
+
+bool WorkerPool::trySubmit(Task task) {
+	{
+		std::lock_guard<std::mutex> guard(mutex);
+		if (stopped || queue.size() >= maxQueue) {
+			return false;
+		}
+		queue.push_back(std::move(task));
+	}
+	condNotEmpty.notify_one();
+	return true;
+}
+
+size_t WorkerPool::pending() {
+	std::lock_guard<std::mutex> guard(mutex);
+	return queue.size();
+}
+
+void WorkerPool::stop() {
+	{
+		std::lock_guard<std::mutex> guard(mutex);
+		if (stopped) {
+			return;
+		}
+		stopped = true;
+	}
+	condNotEmpty.notify_all();
+	for (auto &th : workers) {
+		th.join();
+	}
+}
+
+void WorkerPool::work(int i) {
+	if (cpu >= 0) {
+		int ncpus = std::thread::hardware_concurrency();
+		if (ncpus > 0) {
+			cpu_set_t set;
+			CPU_ZERO(&set);
+			CPU_SET((cpu + i) % ncpus, &set);
+			int rc = pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+			if (rc != 0) {
+				LOG(WARNING) << "worker pool:" << name << " pin worker:" << i << " failed:" << rc;
+			}
+		}
+	}
+	while (true) {
+		Task task;
+		{
+			std::unique_lock<std::mutex> ulk(mutex);
+			condNotEmpty.wait(ulk, [&]()->bool {return stopped || !queue.empty(); });
+			if (queue.empty()) {
+				return;
+			}
+			task = std::move(queue.front());
+			queue.pop_front();
+		}
+		try {
+			task();
+		} catch(...) {
+			LOG(WARNING) << "worker pool:" << name << " task failed";
+		}
+	}
+}